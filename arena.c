@@ -0,0 +1,171 @@
+#include "token.h"
+
+// Region (bump) allocator. Every region hands out memory by bumping a
+// pointer through a chunk and gets a new, twice as large chunk when the
+// current one is exhausted, so a region of n bytes owns O(log n) chunks.
+// Nothing is ever freed individually; a whole region goes away at once
+// with arena_release().
+//
+// Arrays that keep growing until they are complete, like a file's token
+// array, are allocated as separate blocks that can be resized in place
+// of copying them into ever larger bump allocations.
+
+#define ARENA_MIN_CHUNK (64 * 1024)
+#define ARENA_MAX_CHUNK (64 * 1024 * 1024)
+#define ARENA_ALIGN 16
+
+struct ArenaChunk {
+        ArenaChunk *next;
+        size_t size;
+};
+
+struct ArenaBlock {
+        ArenaBlock *next;
+        ArenaBlock **prev; // Link pointing to this block
+        size_t size;
+};
+
+// Block headers are padded to ARENA_ALIGN as well
+#define BLOCK_HEADER ((sizeof(ArenaBlock) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+_Thread_local Arena token_arena = {"tokens"};
+_Thread_local Arena node_arena = {"ast"};
+_Thread_local Arena type_arena = {"types"};
+_Thread_local Arena symbol_arena = {"symbols"};
+_Thread_local Arena ir_arena = {"ir"};
+_Thread_local Arena header_arena = {"headers"};
+
+#define REGION_COUNT 6
+
+// The addresses of thread-local regions are not constants, so the
+// region list is built on each call
+static Arena *region(int i) {
+        Arena *regions[REGION_COUNT] = {&token_arena, &node_arena, &type_arena, &symbol_arena, &ir_arena, &header_arena};
+        return regions[i];
+}
+
+static void new_chunk(Arena *arena, size_t size) {
+        size_t chunk_size = arena->chunks ? arena->chunks->size * 2 : ARENA_MIN_CHUNK;
+        if (chunk_size > ARENA_MAX_CHUNK)
+                chunk_size = ARENA_MAX_CHUNK;
+        if (chunk_size < size + ARENA_ALIGN)
+                chunk_size = size + ARENA_ALIGN;
+
+        // The header is padded to ARENA_ALIGN so the first object is aligned too
+        ArenaChunk *chunk = malloc(ARENA_ALIGN + chunk_size);
+        if (chunk == NULL)
+                error("not enough memory in system to allocate %s region", arena->name);
+        chunk->next = arena->chunks;
+        chunk->size = chunk_size;
+        arena->chunks = chunk;
+        arena->ptr = (char *)chunk + ARENA_ALIGN;
+        arena->end = arena->ptr + chunk_size;
+        arena->reserved += chunk_size;
+}
+
+// Returns zero-initialized memory from `arena`
+void *arena_alloc(Arena *arena, size_t size) {
+        size = align_to(size, ARENA_ALIGN);
+        if (arena->end - arena->ptr < (ptrdiff_t)size)
+                new_chunk(arena, size);
+
+        void *p = arena->ptr;
+        arena->ptr += size;
+        arena->used += size;
+        return memset(p, 0, size);
+}
+
+char *arena_strndup(Arena *arena, char *s, size_t n) {
+        char *p = arena_alloc(arena, n + 1);
+        memcpy(p, s, n);
+        return p;
+}
+
+// Returns a zero-initialized block that can later be passed to
+// arena_resize_block(). Pass NULL to allocate a new one.
+void *arena_resize_block(Arena *arena, void *p, size_t size) {
+        ArenaBlock *block = p ? (ArenaBlock *)((char *)p - BLOCK_HEADER) : NULL;
+        size_t old_size = block ? block->size : 0;
+
+        block = realloc(block, BLOCK_HEADER + size);
+        if (block == NULL)
+                error("not enough memory in system to allocate %s region", arena->name);
+        if (size > old_size)
+                memset((char *)block + BLOCK_HEADER + old_size, 0, size - old_size);
+
+        if (!p) {
+                block->next = arena->blocks;
+                if (block->next)
+                        block->next->prev = &block->next;
+                arena->blocks = block;
+                block->prev = &arena->blocks;
+        } else {
+                // realloc may have moved the block
+                *block->prev = block;
+                if (block->next)
+                        block->next->prev = &block->next;
+        }
+
+        block->size = size;
+        arena->used += size - old_size;
+        arena->reserved += size - old_size;
+        return (char *)block + BLOCK_HEADER;
+}
+
+// Frees every object allocated from `arena` at once
+void arena_release(Arena *arena) {
+        if (arena->reserved > arena->peak)
+                arena->peak = arena->reserved;
+        ArenaChunk *chunk = arena->chunks;
+        while (chunk) {
+                ArenaChunk *next = chunk->next;
+                free(chunk);
+                chunk = next;
+        }
+        ArenaBlock *block = arena->blocks;
+        while (block) {
+                ArenaBlock *next = block->next;
+                free(block);
+                block = next;
+        }
+        arena->chunks = NULL;
+        arena->blocks = NULL;
+        arena->ptr = arena->end = NULL;
+        arena->used = arena->reserved = 0;
+}
+
+// Moves everything allocated from `arena` so far into a new region that
+// can be released on its own, possibly by another thread
+Arena arena_detach(Arena *arena) {
+        Arena detached = *arena;
+        if (arena->reserved > arena->peak)
+                arena->peak = arena->reserved;
+        *arena = (Arena){arena->name, .peak = arena->peak};
+        return detached;
+}
+
+// Releases the regions of the last translation unit. Cached headers
+// are shared with other threads and units, so header_arena stays.
+void release_all_arenas(void) {
+        for (int i = 0; i < REGION_COUNT; i++) {
+                if (region(i) == &header_arena)
+                        continue;
+                arena_release(region(i));
+                region(i)->peak = 0;
+        }
+}
+
+void print_mem_stats(FILE *out) {
+        size_t used = 0, reserved = 0, peak = 0;
+        for (int i = 0; i < REGION_COUNT; i++) {
+                Arena *arena = region(i);
+                size_t arena_peak = arena->reserved > arena->peak ? arena->reserved : arena->peak;
+                fprintf(out, "%-8s %12zu bytes used %12zu bytes reserved %12zu bytes peak\n",
+                                arena->name, arena->used, arena->reserved, arena_peak);
+                used += arena->used;
+                reserved += arena->reserved;
+                peak += arena_peak;
+        }
+        fprintf(out, "%-8s %12zu bytes used %12zu bytes reserved %12zu bytes peak\n",
+                        "total", used, reserved, peak);
+}
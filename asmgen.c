@@ -1,14 +1,22 @@
 #include "token.h"
 
 // Code generator
-static FILE *output_file;
-static int depth;
+// -O level and whether to run the peephole optimizer; set before any
+// thread starts
+static int opt_level;
+static bool opt_peephole;
+
+// Code generator state is per thread, see reset_codegen()
+static _Thread_local Output *output;
+static _Thread_local AsmBuffer asm_buf = {.text.fd = -1}; // Lines the peephole optimizer has not seen yet
+static _Thread_local int depth;
+static _Thread_local int label_count = 1; // Restarts in every function
 
 static char *argreg8[] = {"%dil", "%sil", "%dl", "%cl", "%r8b", "%r9b"};
 static char *argreg16[] = {"%di", "%si", "%dx", "%cx", "%r8w", "%r9w"};
 static char *argreg32[] = {"%edi", "%esi", "%edx", "%ecx", "%r8d", "%r9d"};
 static char *argreg64[] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
-static Obj *current_func;
+static _Thread_local Obj *current_func;
 
 static void gen_expr(Node *node);
 static void gen_statement(Node *node);
@@ -16,14 +24,17 @@ static void gen_statement(Node *node);
 static void println(char *fmt, ...) {
         va_list argument_pointer;
         va_start(argument_pointer, fmt);
-        vfprintf(output_file, fmt, argument_pointer);
+        if (opt_peephole) {
+                asm_vprintf(&asm_buf, fmt, argument_pointer);
+        } else {
+                out_vformat(output, fmt, argument_pointer);
+                out_putc(output, '\n');
+        }
         va_end(argument_pointer);
-        fprintf(output_file, "\n");
 }
 
 static int count(void) {
-        static int i = 1;
-        return i++; 
+        return label_count++;
 }
 
 static void push(void) {
@@ -165,7 +176,7 @@ static void cast(Type *from, Type *to) {
 
 // Generate assembly code to handle the logic of given node 
 static void gen_expr(Node *node) {
-        println(" .loc 1 %d", node->token->line_num);
+        println(" .loc %d %d", node->token->file_no, node->token->line_num);
 
         switch (node->node_type) {
                 case ND_NUM:
@@ -219,30 +230,30 @@ static void gen_expr(Node *node) {
                                         int c = count();
                                         gen_expr(node->left);
                                         println("  cmp $0, %%rax");
-                                        println("  je .L.false.%d", c);
+                                        println("  je .L.false.%s.%d", current_func->name, c);
                                         gen_expr(node->right);
                                         println("  cmp $0, %%rax");
-                                        println("  je .L.false.%d", c);
+                                        println("  je .L.false.%s.%d", current_func->name, c);
                                         println("  mov $1, %%rax");
-                                        println("  jmp .L.end.%d", c);
-                                        println(".L.false.%d:", c);
+                                        println("  jmp .L.end.%s.%d", current_func->name, c);
+                                        println(".L.false.%s.%d:", current_func->name, c);
                                         println("  mov $0, %%rax");
-                                        println(".L.end.%d:", c);
+                                        println(".L.end.%s.%d:", current_func->name, c);
                                         return; 
                                 }
                 case ND_LOGOR:
                                 int c = count();
                                 gen_expr(node->left);
                                 println("  cmp $0, %%rax");
-                                println("  jne .L.true.%d", c);
+                                println("  jne .L.true.%s.%d", current_func->name, c);
                                 gen_expr(node->right);
                                 println("  cmp $0, %%rax");
-                                println("  jne .L.true.%d", c);
+                                println("  jne .L.true.%s.%d", current_func->name, c);
                                 println("  mov $0, %%rax");
-                                println("  jmp .L.end.%d", c);
-                                println(".L.true.%d:", c);
+                                println("  jmp .L.end.%s.%d", current_func->name, c);
+                                println(".L.true.%s.%d:", current_func->name, c);
                                 println("  mov $1, %%rax");
-                                println(".L.end.%d:", c);
+                                println(".L.end.%s.%d:", current_func->name, c);
                                 return;
                 case ND_FUNCALL:
                                 int nargs = 0;
@@ -307,6 +318,7 @@ static void gen_expr(Node *node) {
                         return;
                 case ND_BITXOR:
                         println("  xor %%rdi, %%rax");
+                        return;
                 case ND_EQ:
                 case ND_NE:
                 case ND_LT:
@@ -331,7 +343,7 @@ static void gen_expr(Node *node) {
 }
 
 static void gen_statement(Node *node) {
-        println(" .loc 1 %d", node->token->line_num);
+        println(" .loc %d %d", node->token->file_no, node->token->line_num);
 
         int c = 0;
         switch (node->node_type) {
@@ -339,29 +351,29 @@ static void gen_statement(Node *node) {
                         c = count();
                         gen_expr(node->cond);
                         println("  cmp $0, %%rax");
-                        println("  je  .L.else.%d", c);
+                        println("  je  .L.else.%s.%d", current_func->name, c);
                         gen_statement(node->then);
-                        println("  jmp .L.end.%d", c);
-                        println(".L.else.%d:", c);
+                        println("  jmp .L.end.%s.%d", current_func->name, c);
+                        println(".L.else.%s.%d:", current_func->name, c);
                         if (node->els)
                                 gen_statement(node->els);
-                        println(".L.end.%d:", c);
+                        println(".L.end.%s.%d:", current_func->name, c);
                         return;
                 case ND_FOR:
                         c = count();
                         if (node->init)
                                 gen_statement(node->init);
-                        println(".L.begin.%d:", c);
+                        println(".L.begin.%s.%d:", current_func->name, c);
                         if (node->cond) {
                                 gen_expr(node->cond);
                                 println("  cmp $0, %%rax");
-                                println("  je  .L.end.%d", c);
+                                println("  je  .L.end.%s.%d", current_func->name, c);
                         }
                         gen_statement(node->then);
                         if (node->inc) 
                                 gen_expr(node->inc);
-                        println("  jmp .L.begin.%d", c);
-                        println(".L.end.%d:", c);
+                        println("  jmp .L.begin.%s.%d", current_func->name, c);
+                        println(".L.end.%s.%d:", current_func->name, c);
                         return;
                 case ND_NULL_STATEMENT:
                         return;
@@ -384,20 +396,17 @@ static void gen_statement(Node *node) {
 
 // Source: https://stackoverflow.com/questions/70778878/how-do-programs-know-how-much-space-to-allocate-for-local-variables-on-the-stack
 // Assigns offsets to local variables for memory allocation
-static void assign_lvar_offsets(Obj *program) {
+static void assign_lvar_offsets(Obj *func) {
         int offset = 0;
-        for (Obj *func = program; func; func = func->next) {
-                if (!func->is_function)
+        for (Obj *var = func->locals; var; var = var->next) {
+                // -O1 keeps some variables in registers
+                if (var->vreg)
                         continue;
-
-                int offset = 0;
-                for (Obj *var = func->locals; var; var = var->next) {
-                        offset += var->type->size;
-                        offset = align_to(offset, var->type->align);
-                        var->offset = -offset;
-                }
-                func->stack_size = align_to(offset, 16);
+                offset += var->type->size;
+                offset = align_to(offset, var->type->align);
+                var->offset = -offset;
         }
+        func->stack_size = align_to(offset, 16);
 }
 
 static void emit_data(Obj *program) {
@@ -405,14 +414,22 @@ static void emit_data(Obj *program) {
                 if (var->is_function)
                         continue;
 
-                println("  .data");
-                println("  .globl %s", var->name);
-                println("%s:", var->name);
-                if (var->init_data)
+                // Only string literals have contents, and they are
+                // read-only; everything else starts out zero
+                if (var->is_static)
+                        println("  .local %s", var->name);
+                else
+                        println("  .globl %s", var->name);
+                if (var->init_data) {
+                        println("  .section .rodata");
+                        println("%s:", var->name);
                         for (int i = 0; i < var->type->size; i++)
                                 println("  .byte %d", var->init_data[i]);
-                else
+                } else {
+                        println("  .bss");
+                        println("%s:", var->name);
                         println("  .zero %d", var->type->size);
+                }
         }
 }
 
@@ -434,48 +451,621 @@ static void store_gp(int r, int offset, int sz) {
         unreachable();
 }
 
-static void emit_text(Obj *program) {
-        for (Obj *func = program; func; func = func->next) {
-                if (!func->is_function || !func->is_definition)
-                        continue;
+static void gen_function(Obj *func) {
+        if (func->is_static)
+                println("  .local %s", func->name);
+        else 
+                println("  .globl %s", func->name);
+
+        println("  .text");
+        println("%s:", func->name);
+        current_func = func;
+        label_count = 1;
+
+        // Setting up stack frame
+        // %rbp is the base pointer register in this implementation
+        println("  push %%rbp"); // Save caller's base pointer
+        println("  mov %%rsp, %%rbp"); // Set the base pointer to the current stack pointer
+        println("  sub $%d, %%rsp", func->stack_size); // Allocate space
+
+        // Save passed-by-register args to the stack
+        int i = 0;
+        for (Obj *var = func->params; var; var = var->next)
+                store_gp(i++, var->offset, var->type->size);
+
+        // Emit code
+        gen_statement(func->body);
+        assert(depth == 0);
+
+        println(".L.return.%s:", func->name);
+
+        // Tear down stack frame
+        println("  mov %%rbp, %%rsp"); // Reset stack pointer
+        println("  pop %%rbp"); // Restore caller's base pointer
+        println("  ret");
+}
+
+// -O1: code from the three-address code of ir.c, with the virtual
+// registers mapped to machine registers by regalloc.c. %rax, %rdx and
+// %r11 are scratch registers.
+
+static char *reg64[] = {"%rcx", "%rsi", "%rdi", "%r8", "%r9", "%r10",
+        "%rbx", "%r12", "%r13", "%r14", "%r15", "%rax", "%rdx", "%r11"};
+static char *reg32[] = {"%ecx", "%esi", "%edi", "%r8d", "%r9d", "%r10d",
+        "%ebx", "%r12d", "%r13d", "%r14d", "%r15d", "%eax", "%edx", "%r11d"};
+static char *reg16[] = {"%cx", "%si", "%di", "%r8w", "%r9w", "%r10w",
+        "%bx", "%r12w", "%r13w", "%r14w", "%r15w", "%ax", "%dx", "%r11w"};
+static char *reg8[] = {"%cl", "%sil", "%dil", "%r8b", "%r9b", "%r10b",
+        "%bl", "%r12b", "%r13b", "%r14b", "%r15b", "%al", "%dl", "%r11b"};
+
+static Reg argregs[] = {REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9};
+
+static _Thread_local IRFunc *ir;
+static _Thread_local int *use_count;
+static _Thread_local int spill_offset; // Bytes of the frame below the locals
+
+// Operands are formatted into a few rotating buffers, enough for the
+// operands of one instruction
+static _Thread_local char operand_buf[4][64];
+static _Thread_local int operand_next;
+
+static char *operand(char *fmt, ...) {
+        char *buf = operand_buf[operand_next++ % 4];
+        va_list ap;
+        va_start(ap, fmt);
+        vsnprintf(buf, sizeof(operand_buf[0]), fmt, ap);
+        va_end(ap);
+        return buf;
+}
+
+static char *reg_name(Reg reg, int size) {
+        switch (size) {
+                case 1:
+                        return reg8[reg];
+                case 2:
+                        return reg16[reg];
+                case 4:
+                        return reg32[reg];
+        }
+        return reg64[reg];
+}
+
+static bool in_reg(int v) {
+        return ir->reg[v] >= 0;
+}
+
+static char *spill_slot(int v) {
+        return operand("%d(%%rbp)", -(spill_offset + 8 * (ir->spill[v] + 1)));
+}
+
+// The register or spill slot of virtual register `v`
+static char *location(int v, int size) {
+        return in_reg(v) ? reg_name(ir->reg[v], size) : spill_slot(v);
+}
+
+// The right operand of a binary operation
+static char *right_operand(IRInst *inst) {
+        return inst->b ? location(inst->b, inst->size) : operand("$%ld", inst->imm);
+}
+
+// Returns the register holding `v`, loading it into `scratch` first
+// if it is spilled
+static Reg use_reg(int v, Reg scratch) {
+        if (in_reg(v))
+                return ir->reg[v];
+        println("  mov %s, %s", spill_slot(v), reg64[scratch]);
+        return scratch;
+}
+
+// Returns the register to compute `v` in; %rax if it is spilled
+static Reg def_reg(int v) {
+        return in_reg(v) ? ir->reg[v] : REG_RAX;
+}
 
-                if (func->is_static)
-                        println("  .local %s", func->name);
-                else 
-                        println("  .globl %s", func->name);
+// Stores the value computed in `reg` if `v` is spilled
+static void finish_def(int v, Reg reg) {
+        if (!in_reg(v))
+                println("  mov %s, %s", reg64[reg], spill_slot(v));
+}
 
-                println("  .text");
-                println("%s:", func->name);
-                current_func = func;
+// Moves a result that is in scratch register `reg` to `v`
+static void set_result(int v, Reg reg) {
+        if (in_reg(v))
+                println("  mov %s, %s", reg64[reg], reg64[ir->reg[v]]);
+        else
+                finish_def(v, reg);
+}
 
-                // Setting up stack frame
-                // %rbp is the base pointer register in this implementation
-                println("  push %%rbp"); // Save caller's base pointer
-                println("  mov %%rsp, %%rbp"); // Set the base pointer to the current stack pointer
-                println("  sub $%d, %%rsp", func->stack_size); // Allocate space
+static void move(int dst, int src) {
+        if (in_reg(dst) && in_reg(src) && ir->reg[dst] == ir->reg[src])
+                return;
+        if (!in_reg(dst) && !in_reg(src)) {
+                println("  mov %s, %%rax", spill_slot(src));
+                println("  mov %%rax, %s", spill_slot(dst));
+                return;
+        }
+        println("  mov %s, %s", location(src, 8), location(dst, 8));
+}
 
-                // Save passed-by-register args to the stack
+// The memory operand of IR_ADDR, IR_LOAD, IR_STORE and IR_COPY. A
+// spilled base is loaded into %r11.
+static char *address(IRInst *inst) {
+        if (!inst->var)
+                return operand("%d(%s)", inst->offset, reg64[use_reg(inst->a, REG_R11)]);
+        if (inst->var->is_local)
+                return operand("%d(%%rbp)", inst->var->offset + inst->offset);
+        if (inst->offset)
+                return operand("%s+%d(%%rip)", inst->var->name, inst->offset);
+        return operand("%s(%%rip)", inst->var->name);
+}
+
+// Moves registers into registers as if all moves happened at once.
+// A move whose destination is still to be read by another one waits;
+// when only such moves are left, they form cycles, which are broken by
+// saving one source in %rax.
+static void parallel_move(Reg *src, Reg *dst, int n) {
+        while (n > 0) {
                 int i = 0;
-                for (Obj *var = func->params; var; var = var->next)
-                        store_gp(i++, var->offset, var->type->size);
+                for (; i < n; i++) {
+                        bool blocked = false;
+                        for (int j = 0; j < n; j++)
+                                if (j != i && src[j] == dst[i])
+                                        blocked = true;
+                        if (!blocked)
+                                break;
+                }
 
-                // Emit code
-                gen_statement(func->body);
-                assert(depth == 0);
+                if (i == n) {
+                        println("  mov %s, %%rax", reg64[src[0]]);
+                        src[0] = REG_RAX;
+                        continue;
+                }
 
-                println(".L.return.%s:", func->name);
+                if (src[i] != dst[i])
+                        println("  mov %s, %s", reg64[src[i]], reg64[dst[i]]);
+                src[i] = src[n - 1];
+                dst[i] = dst[n - 1];
+                n--;
+        }
+}
 
-                // Tear down stack frame
-                println("  mov %%rbp, %%rsp"); // Reset stack pointer
-                println("  pop %%rbp"); // Restore caller's base pointer
-                println("  ret");
+static void gen_params(IRInst *inst) {
+        Reg src[6], dst[6];
+        int n = 0;
+        for (int i = 0; i < inst->nargs; i++) {
+                int v = inst->args[i];
+                if (!in_reg(v)) {
+                        println("  mov %s, %s", reg64[argregs[i]], spill_slot(v));
+                } else {
+                        src[n] = argregs[i];
+                        dst[n++] = ir->reg[v];
+                }
         }
+        parallel_move(src, dst, n);
 }
 
-void gen_asm(Obj *program, FILE *out) {
-        output_file = out;
+static void gen_call(IRInst *inst) {
+        Reg src[6], dst[6];
+        int n = 0;
+        for (int i = 0; i < inst->nargs; i++) {
+                if (in_reg(inst->args[i])) {
+                        src[n] = ir->reg[inst->args[i]];
+                        dst[n++] = argregs[i];
+                }
+        }
+        parallel_move(src, dst, n);
+        for (int i = 0; i < inst->nargs; i++)
+                if (!in_reg(inst->args[i]))
+                        println("  mov %s, %s", spill_slot(inst->args[i]), reg64[argregs[i]]);
+
+        println("  mov $0, %%eax");
+        println("  call %s", inst->funcname);
+        set_result(inst->dst, REG_RAX);
+}
+
+static void gen_copy(IRInst *inst) {
+        println("  lea %s, %%r11", address(inst));
+        char *src = reg64[use_reg(inst->b, REG_RAX)];
+        for (int i = 0; i < inst->size;) {
+                int chunk = inst->size - i >= 8 ? 8 : inst->size - i >= 4 ? 4 : inst->size - i >= 2 ? 2 : 1;
+                println("  mov %d(%s), %s", i, src, reg_name(REG_RDX, chunk));
+                println("  mov %s, %d(%%r11)", reg_name(REG_RDX, chunk), i);
+                i += chunk;
+        }
+}
+
+static char *binary_mnemonic(IROp op) {
+        switch (op) {
+                case IR_ADD:
+                        return "add";
+                case IR_SUB:
+                        return "sub";
+                case IR_MUL:
+                        return "imul";
+                case IR_AND:
+                        return "and";
+                case IR_OR:
+                        return "or";
+                case IR_XOR:
+                        return "xor";
+        }
+        unreachable();
+}
+
+static void gen_binary(IRInst *inst) {
+        Reg d = def_reg(inst->dst);
+        char *mnemonic = binary_mnemonic(inst->op);
+
+        // dst = a - dst can not be computed in dst
+        if (inst->b && inst->a != inst->b && in_reg(inst->b) && ir->reg[inst->b] == d) {
+                if (inst->op == IR_SUB) {
+                        println("  mov %s, %%rax", location(inst->a, 8));
+                        println("  sub %s, %s", reg_name(d, inst->size), reg_name(REG_RAX, inst->size));
+                        println("  mov %%rax, %s", reg64[d]);
+                        return;
+                }
+                println("  %s %s, %s", mnemonic, location(inst->a, inst->size), reg_name(d, inst->size));
+                return;
+        }
+
+        if (!in_reg(inst->a) || ir->reg[inst->a] != d)
+                println("  mov %s, %s", location(inst->a, 8), reg64[d]);
+        println("  %s %s, %s", mnemonic, right_operand(inst), reg_name(d, inst->size));
+        finish_def(inst->dst, d);
+}
+
+static void gen_divide(IRInst *inst) {
+        println("  mov %s, %%rax", location(inst->a, 8));
+        if (inst->size == 8) {
+                println("  cqo");
+                println("  idivq %s", location(inst->b, 8));
+        } else {
+                println("  cdq");
+                println("  idivl %s", location(inst->b, 4));
+        }
+        set_result(inst->dst, inst->op == IR_MOD ? REG_RDX : REG_RAX);
+}
+
+static char *condition_code(IROp op, bool negate) {
+        switch (op) {
+                case IR_EQ:
+                        return negate ? "ne" : "e";
+                case IR_NE:
+                        return negate ? "e" : "ne";
+                case IR_LT:
+                        return negate ? "ge" : "l";
+                case IR_LE:
+                        return negate ? "g" : "le";
+        }
+        unreachable();
+}
 
-        assign_lvar_offsets(program);
+// A comparison only the branch right after it looks at is not turned
+// into a number; the branch tests the flags instead
+static bool is_fused(IRInst *inst) {
+        IRInst *next = inst->next;
+        return inst->op >= IR_EQ && inst->op <= IR_LE && next && next->op == IR_BR &&
+                next->a == inst->dst && use_count[inst->dst] == 1;
+}
+
+static void gen_compare(IRInst *inst) {
+        Reg a = use_reg(inst->a, REG_RAX);
+        println("  cmp %s, %s", right_operand(inst), reg_name(a, inst->size));
+}
+
+static char *block_label(IRBlock *block) {
+        return operand(".L.bb.%s.%d", ir->func->name, block->id);
+}
+
+// Jumps to `then` if condition `cc` holds and to `els` otherwise,
+// leaving out a jump to the block that comes next
+static void gen_branch(IRBlock *block, char *cc, char *negated, IRBlock *then, IRBlock *els) {
+        if (els == block->next) {
+                println("  j%s %s", cc, block_label(then));
+        } else if (then == block->next) {
+                println("  j%s %s", negated, block_label(els));
+        } else {
+                println("  j%s %s", cc, block_label(then));
+                println("  jmp %s", block_label(els));
+        }
+}
+
+static void gen_inst(IRBlock *block, IRInst *inst) {
+        switch (inst->op) {
+                case IR_IMM: {
+                                Reg d = def_reg(inst->dst);
+                                if (inst->imm == 0)
+                                        println("  xor %s, %s", reg32[d], reg32[d]);
+                                else
+                                        println("  mov $%ld, %s", inst->imm, reg64[d]);
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_MOV:
+                        move(inst->dst, inst->a);
+                        return;
+                case IR_ADD:
+                case IR_SUB:
+                case IR_MUL:
+                case IR_AND:
+                case IR_OR:
+                case IR_XOR:
+                        gen_binary(inst);
+                        return;
+                case IR_DIV:
+                case IR_MOD:
+                        gen_divide(inst);
+                        return;
+                case IR_EQ:
+                case IR_NE:
+                case IR_LT:
+                case IR_LE: {
+                                gen_compare(inst);
+                                if (is_fused(inst)) {
+                                        gen_branch(block, condition_code(inst->op, false),
+                                                        condition_code(inst->op, true), inst->next->then, inst->next->els);
+                                        return;
+                                }
+
+                                Reg d = def_reg(inst->dst);
+                                println("  set%s %s", condition_code(inst->op, false), reg8[d]);
+                                println("  movzbl %s, %s", reg8[d], reg32[d]);
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_NEG:
+                case IR_BITNOT: {
+                                Reg d = def_reg(inst->dst);
+                                if (!in_reg(inst->a) || ir->reg[inst->a] != d)
+                                        println("  mov %s, %s", location(inst->a, 8), reg64[d]);
+                                println("  %s %s", inst->op == IR_NEG ? "neg" : "not", reg_name(d, inst->size));
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_SEXT: {
+                                Reg d = def_reg(inst->dst);
+                                if (inst->size == 1)
+                                        println("  movsbl %s, %s", location(inst->a, 1), reg32[d]);
+                                else if (inst->size == 2)
+                                        println("  movswl %s, %s", location(inst->a, 2), reg32[d]);
+                                else
+                                        println("  movslq %s, %s", location(inst->a, 4), reg64[d]);
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_ADDR: {
+                                Reg d = def_reg(inst->dst);
+                                println("  lea %s, %s", address(inst), reg64[d]);
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_LOAD: {
+                                Reg d = def_reg(inst->dst);
+                                if (inst->size == 1)
+                                        println("  movsbl %s, %s", address(inst), reg32[d]);
+                                else if (inst->size == 2)
+                                        println("  movswl %s, %s", address(inst), reg32[d]);
+                                else
+                                        println("  mov %s, %s", address(inst), reg_name(d, inst->size));
+                                finish_def(inst->dst, d);
+                                return;
+                        }
+                case IR_STORE: {
+                                static char suffix[] = {[1] = 'b', [2] = 'w', [4] = 'l', [8] = 'q'};
+                                char *addr = address(inst);
+                                if (!inst->b)
+                                        println("  mov%c $%ld, %s", suffix[inst->size], inst->imm, addr);
+                                else
+                                        println("  mov %s, %s", reg_name(use_reg(inst->b, REG_RAX), inst->size), addr);
+                                return;
+                        }
+                case IR_COPY:
+                        gen_copy(inst);
+                        return;
+                case IR_CALL:
+                        gen_call(inst);
+                        return;
+                case IR_PARAMS:
+                        gen_params(inst);
+                        return;
+                case IR_JMP:
+                        if (inst->then != block->next)
+                                println("  jmp %s", block_label(inst->then));
+                        return;
+                case IR_BR: {
+                                Reg a = use_reg(inst->a, REG_RAX);
+                                println("  test %s, %s", reg_name(a, inst->size), reg_name(a, inst->size));
+                                gen_branch(block, "ne", "e", inst->then, inst->els);
+                                return;
+                        }
+                case IR_RET:
+                        if (inst->a)
+                                println("  mov %s, %%rax", location(inst->a, 8));
+                        if (block->next)
+                                println("  jmp .L.return.%s", ir->func->name);
+                        return;
+        }
+        unreachable();
+}
+
+static void gen_function_opt(Obj *func) {
+        ir = gen_ir(func);
+        leave_ssa(ir);
+        allocate_registers(ir);
+        assign_lvar_offsets(func);
+
+        use_count = calloc(ir->vreg_count + 1, sizeof(int));
+        int uses[8];
+        for (IRBlock *block = ir->blocks; block; block = block->next)
+                for (IRInst *inst = block->insts; inst; inst = inst->next)
+                        for (int i = 0, n = ir_uses(inst, uses); i < n; i++)
+                                use_count[uses[i]]++;
+
+        // The frame holds the locals in memory, the spill slots and the
+        // callee-saved registers the function uses
+        bool saved[REG_ALLOCATABLE] = {};
+        int nsaved = 0;
+        for (int v = 1; v <= ir->vreg_count; v++) {
+                int reg = ir->reg[v];
+                if (reg >= REG_FIRST_CALLEE_SAVED && !saved[reg]) {
+                        saved[reg] = true;
+                        nsaved++;
+                }
+        }
+        spill_offset = func->stack_size;
+        int save_offset = spill_offset + 8 * ir->spill_count;
+        int frame_size = align_to(save_offset + 8 * nsaved, 16);
+
+        if (func->is_static)
+                println("  .local %s", func->name);
+        else
+                println("  .globl %s", func->name);
+        println("  .text");
+        println("%s:", func->name);
+        println("  push %%rbp");
+        println("  mov %%rsp, %%rbp");
+        println("  sub $%d, %%rsp", frame_size);
+        int offset = save_offset;
+        for (int reg = REG_FIRST_CALLEE_SAVED; reg < REG_ALLOCATABLE; reg++)
+                if (saved[reg])
+                        println("  mov %s, %d(%%rbp)", reg64[reg], -(offset += 8));
+
+        int file = 0, line = 0;
+        for (IRBlock *block = ir->blocks; block; block = block->next) {
+                println("%s:", block_label(block));
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (inst->file != file || inst->line != line) {
+                                file = inst->file;
+                                line = inst->line;
+                                println(" .loc %d %d", file, line);
+                        }
+                        gen_inst(block, inst);
+                        if (is_fused(inst))
+                                inst = inst->next;
+                }
+        }
+
+        println(".L.return.%s:", func->name);
+        offset = save_offset;
+        for (int reg = REG_FIRST_CALLEE_SAVED; reg < REG_ALLOCATABLE; reg++)
+                if (saved[reg])
+                        println("  mov %d(%%rbp), %s", -(offset += 8), reg64[reg]);
+        println("  mov %%rbp, %%rsp");
+        println("  pop %%rbp");
+        println("  ret");
+
+        free(use_count);
+        use_count = NULL;
+        ir = NULL;
+        arena_release(&ir_arena);
+}
+
+static void generate(Obj *func) {
+        if (opt_level)
+                gen_function_opt(func);
+        else
+                gen_function(func);
+        if (opt_peephole) {
+                peephole(&asm_buf);
+                asm_flush(&asm_buf, output);
+        }
+}
+
+// Functions are independent of each other once local variable offsets
+// are assigned, and their labels are numbered per function, so they can
+// be generated on several threads. Every function is written to its own
+// buffer and the buffers are written out in source order, which makes
+// the output the same as that of a serial run.
+static Obj **func_list;
+static Output *func_texts;
+
+// File table of the thread that tokenized the program, for error messages
+static File **program_files;
+
+static void gen_function_job(int i) {
+        set_input_files(program_files);
+        output = &func_texts[i];
+        generate(func_list[i]);
+        reset_codegen();
+        set_input_files(NULL);
+}
+
+static void emit_text(Obj *program, int jobs) {
+        int n = 0;
+        for (Obj *func = program; func; func = func->next)
+                if (func->is_function && func->is_definition)
+                        n++;
+
+        if (jobs <= 1 || n <= 1) {
+                for (Obj *func = program; func; func = func->next)
+                        if (func->is_function && func->is_definition)
+                                generate(func);
+                return;
+        }
+
+        func_list = calloc(n, sizeof(Obj *));
+        func_texts = calloc(n, sizeof(Output));
+        n = 0;
+        for (Obj *func = program; func; func = func->next) {
+                if (func->is_function && func->is_definition) {
+                        func_texts[n].fd = -1;
+                        func_list[n++] = func;
+                }
+        }
+
+        program_files = get_input_files();
+        run_jobs(n, jobs, gen_function_job);
+
+        out_append(output, func_texts, n);
+        for (int i = 0; i < n; i++)
+                free(func_texts[i].buf);
+        free(func_texts);
+        free(func_list);
+        func_texts = NULL;
+        func_list = NULL;
+}
+
+// Writes the assembly of `program` to `out`, generating the functions
+// on `jobs` threads
+void gen_asm(Obj *program, Output *out, int jobs) {
+        output = out;
+
+        for (Obj *func = program; func; func = func->next)
+                if (func->is_function)
+                        assign_lvar_offsets(func);
         emit_data(program);
-        emit_text(program);
+        asm_flush(&asm_buf, output);
+        emit_text(program, jobs);
+}
+
+// Writes one function definition on its own, for generating code while
+// the rest of the file is still being parsed
+void gen_function_text(Obj *func, Output *out) {
+        output = out;
+        assign_lvar_offsets(func);
+        generate(func);
+}
+
+// Writes the global variables of `program`; the counterpart of
+// gen_function_text()
+void gen_data(Obj *program, Output *out) {
+        output = out;
+        emit_data(program);
+        asm_flush(&asm_buf, output);
+}
+
+void set_optimization(int level) {
+        opt_level = level;
+}
+
+void set_peephole(bool enabled) {
+        opt_peephole = enabled;
+}
+
+void reset_codegen(void) {
+        output = NULL;
+        asm_free(&asm_buf);
+        depth = 0;
+        label_count = 1;
+        current_func = NULL;
 }
@@ -0,0 +1,1126 @@
+#include "token.h"
+
+// Integrated assembler for -c and --run. It reads the assembly the code
+// generator writes, which only uses a small part of the AT&T syntax,
+// encodes it as x86-64 machine code and either writes an ELF64
+// relocatable object or loads it into memory and runs it. Jumps always
+// take a 32-bit displacement, and .file and .loc are skipped, so the
+// object has no debug information.
+
+typedef enum {
+        SEC_UNDEF,
+        SEC_TEXT,
+        SEC_DATA,
+        SEC_BSS,
+        SEC_RODATA,
+        SEC_COUNT,
+} SectionId;
+
+typedef struct {
+        char *name; // Interned
+        SectionId section; // SEC_UNDEF if not defined in this file
+        long value; // Offset in the section
+        bool is_global;
+        bool is_referenced;
+        int index; // Index in .symtab, 0 if not in there
+} Symbol;
+
+// A 32-bit PC-relative field that refers to a symbol
+typedef struct {
+        SectionId section;
+        long offset; // Of the field in the section
+        Symbol *sym;
+        long addend; // Relative to the start of the field
+        uint32_t type; // R_X86_64_PC32 or R_X86_64_PLT32
+} Fixup;
+
+typedef struct {
+        char *name;
+        uint32_t type;
+        uint64_t flags;
+        Output data; // Contents, except for .bss
+        size_t size;
+        Elf64_Rela *relocs;
+        int reloc_count;
+        int reloc_cap;
+} Section;
+
+static _Thread_local Section sections[SEC_COUNT];
+static _Thread_local SectionId current;
+
+static _Thread_local Symbol **symbols; // Open addressing on the interned name
+static _Thread_local int symbol_cap;
+static _Thread_local Symbol **symbol_list; // In order of appearance
+static _Thread_local int symbol_count;
+
+static _Thread_local Fixup *fixups;
+static _Thread_local int fixup_count;
+static _Thread_local int fixup_cap;
+
+static _Thread_local char *current_line; // For error messages
+
+static void init_sections(void) {
+        static Section templates[SEC_COUNT] = {
+                [SEC_TEXT] = {".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR},
+                [SEC_DATA] = {".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE},
+                [SEC_BSS] = {".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE},
+                [SEC_RODATA] = {".rodata", SHT_PROGBITS, SHF_ALLOC},
+        };
+        for (int i = 1; i < SEC_COUNT; i++) {
+                sections[i] = templates[i];
+                sections[i].data.fd = -1;
+        }
+        current = SEC_TEXT;
+}
+
+static uint32_t pointer_hash(char *name) {
+        return (uint32_t)(((uintptr_t)name >> 3) * 2654435761u);
+}
+
+static void grow_symbols(void) {
+        Symbol **old = symbols;
+        int old_cap = symbol_cap;
+        symbol_cap = symbol_cap ? symbol_cap * 2 : 1024;
+        symbols = calloc(symbol_cap, sizeof(Symbol *));
+        for (int i = 0; i < old_cap; i++) {
+                if (!old[i])
+                        continue;
+                int j = pointer_hash(old[i]->name) & (symbol_cap - 1);
+                while (symbols[j])
+                        j = (j + 1) & (symbol_cap - 1);
+                symbols[j] = old[i];
+        }
+        free(old);
+        symbol_list = realloc(symbol_list, sizeof(Symbol *) * symbol_cap);
+}
+
+static Symbol *get_symbol(char *s, int len) {
+        if ((symbol_count + 1) * 2 > symbol_cap)
+                grow_symbols();
+
+        char *name = intern(s, len);
+        int i = pointer_hash(name) & (symbol_cap - 1);
+        for (; symbols[i]; i = (i + 1) & (symbol_cap - 1))
+                if (symbols[i]->name == name)
+                        return symbols[i];
+
+        Symbol *sym = arena_alloc(&symbol_arena, sizeof(Symbol));
+        *sym = (Symbol){.name = name};
+        symbols[i] = sym;
+        symbol_list[symbol_count++] = sym;
+        return sym;
+}
+
+static void bad_line(char *msg) {
+        error("assembler: %s: %s", msg, current_line);
+}
+
+static void emit_byte(int c) {
+        if (current == SEC_BSS)
+                bad_line("contents in .bss");
+        out_putc(&sections[current].data, c);
+        sections[current].size++;
+}
+
+static void emit_bytes(long val, int size) {
+        for (int i = 0; i < size; i++)
+                emit_byte(val >> (i * 8));
+}
+
+// Emits a 32-bit field `sym` + `addend` - <address of the field>
+static void emit_pcrel(Symbol *sym, long addend, uint32_t type) {
+        if (fixup_count == fixup_cap) {
+                fixup_cap = fixup_cap ? fixup_cap * 2 : 256;
+                fixups = realloc(fixups, sizeof(Fixup) * fixup_cap);
+        }
+        sym->is_referenced = true;
+        fixups[fixup_count++] = (Fixup){current, sections[current].size, sym, addend, type};
+        emit_bytes(0, 4);
+}
+
+// Operands
+
+#define REG_RIP 16
+
+typedef enum {
+        OP_REG,
+        OP_IMM,
+        OP_MEM,
+        OP_SYM, // Target of a jump or call
+} OperandKind;
+
+typedef struct {
+        OperandKind kind;
+        int reg; // OP_REG: register number; OP_MEM: base register or REG_RIP
+        int size; // OP_REG: size in bytes
+        long imm; // OP_IMM: value; OP_MEM: displacement
+        Symbol *sym; // OP_MEM based on %rip, OP_SYM
+} Operand;
+
+// Register names in the order of their machine encoding
+static char *register_names[][4] = {
+        {"rax", "eax", "ax", "al"}, {"rcx", "ecx", "cx", "cl"},
+        {"rdx", "edx", "dx", "dl"}, {"rbx", "ebx", "bx", "bl"},
+        {"rsp", "esp", "sp", "spl"}, {"rbp", "ebp", "bp", "bpl"},
+        {"rsi", "esi", "si", "sil"}, {"rdi", "edi", "di", "dil"},
+        {"r8", "r8d", "r8w", "r8b"}, {"r9", "r9d", "r9w", "r9b"},
+        {"r10", "r10d", "r10w", "r10b"}, {"r11", "r11d", "r11w", "r11b"},
+        {"r12", "r12d", "r12w", "r12b"}, {"r13", "r13d", "r13w", "r13b"},
+        {"r14", "r14d", "r14w", "r14b"}, {"r15", "r15d", "r15w", "r15b"},
+};
+
+static int register_sizes[] = {8, 4, 2, 1};
+
+static void parse_register(char *s, Operand *op) {
+        if (!strcmp(s, "rip")) {
+                op->reg = REG_RIP;
+                op->size = 8;
+                return;
+        }
+        for (int i = 0; i < 16; i++) {
+                for (int j = 0; j < 4; j++) {
+                        if (!strcmp(s, register_names[i][j])) {
+                                op->reg = i;
+                                op->size = register_sizes[j];
+                                return;
+                        }
+                }
+        }
+        bad_line("unknown register");
+}
+
+static bool is_symbol_char(char c) {
+        return isalnum(c) || c == '_' || c == '.' || c == '$';
+}
+
+static long parse_number(char *s, char **end) {
+        errno = 0;
+        long val = strtol(s, end, 10);
+        if (*end == s || errno)
+                bad_line("bad number");
+        return val;
+}
+
+// Parses `sym`, `sym+N`, `N` or nothing in front of a memory operand
+static void parse_displacement(char *s, char *end, Operand *op) {
+        if (s == end)
+                return;
+        if (isdigit(*s) || *s == '-') {
+                char *p;
+                op->imm = parse_number(s, &p);
+                if (p != end)
+                        bad_line("bad displacement");
+                return;
+        }
+
+        char *p = s;
+        while (p < end && is_symbol_char(*p))
+                p++;
+        op->sym = get_symbol(s, p - s);
+        if (p == end)
+                return;
+        if (*p == '+')
+                p++;
+        op->imm = parse_number(p, &p);
+        if (p != end)
+                bad_line("bad displacement");
+}
+
+static void parse_operand(char *s, Operand *op) {
+        *op = (Operand){};
+        if (*s == '%') {
+                op->kind = OP_REG;
+                parse_register(s + 1, op);
+                if (op->reg == REG_RIP)
+                        bad_line("%rip as an operand");
+                return;
+        }
+
+        if (*s == '$') {
+                char *end;
+                op->kind = OP_IMM;
+                op->imm = parse_number(s + 1, &end);
+                if (*end)
+                        bad_line("bad immediate");
+                return;
+        }
+
+        char *paren = strchr(s, '(');
+        if (!paren) {
+                op->kind = OP_SYM;
+                op->sym = get_symbol(s, strlen(s));
+                return;
+        }
+
+        op->kind = OP_MEM;
+        parse_displacement(s, paren, op);
+        char *close = strchr(paren, ')');
+        if (paren[1] != '%' || !close || close[1])
+                bad_line("bad memory operand");
+        *close = '\0';
+        Operand base;
+        parse_register(paren + 2, &base);
+        if (base.size != 8)
+                bad_line("bad base register");
+        op->reg = base.reg;
+}
+
+// Instruction encoding
+
+// The 8-bit registers %spl, %bpl, %sil and %dil need a REX prefix
+static bool needs_rex(Operand *op) {
+        return op && op->kind == OP_REG && op->size == 1 && op->reg >= 4 && op->reg < 8;
+}
+
+// Emits the prefixes, `opcode` and a ModRM byte with `reg` in the reg
+// field and `rm` as the register or memory operand. `imm_size` bytes of
+// immediate follow, which a %rip-relative displacement has to skip.
+static void emit_modrm(int size, char *opcode, int oplen, int reg, Operand *reg_op, Operand *rm, int imm_size) {
+        if (size == 2)
+                emit_byte(0x66);
+
+        int rex = 0;
+        if (size == 8)
+                rex |= 8;
+        if (reg & 8)
+                rex |= 4;
+        if (rm->kind == OP_REG && (rm->reg & 8))
+                rex |= 1;
+        if (rm->kind == OP_MEM && rm->reg != REG_RIP && (rm->reg & 8))
+                rex |= 1;
+        if (rex || needs_rex(reg_op) || needs_rex(rm))
+                emit_byte(0x40 | rex);
+
+        for (int i = 0; i < oplen; i++)
+                emit_byte((unsigned char)opcode[i]);
+
+        if (rm->kind == OP_REG) {
+                emit_byte(0xC0 | (reg & 7) << 3 | (rm->reg & 7));
+                return;
+        }
+
+        if (rm->reg == REG_RIP) {
+                emit_byte((reg & 7) << 3 | 5);
+                if (rm->sym)
+                        emit_pcrel(rm->sym, rm->imm - 4 - imm_size, R_X86_64_PC32);
+                else
+                        emit_bytes(rm->imm, 4);
+                return;
+        }
+
+        // %rbp and %r13 as a base always take a displacement, %rsp and
+        // %r12 need a SIB byte
+        int base = rm->reg & 7;
+        int mod = 2;
+        if (rm->imm == 0 && base != 5)
+                mod = 0;
+        else if (rm->imm == (int8_t)rm->imm)
+                mod = 1;
+        emit_byte(mod << 6 | (reg & 7) << 3 | base);
+        if (base == 4)
+                emit_byte(0x24);
+        if (mod == 1)
+                emit_bytes(rm->imm, 1);
+        else if (mod == 2)
+                emit_bytes(rm->imm, 4);
+}
+
+static bool fits_int8(long val) {
+        return val == (int8_t)val;
+}
+
+static bool fits_int32(long val) {
+        return val == (int32_t)val;
+}
+
+typedef enum {
+        I_MOV,
+        I_LEA,
+        I_PUSH,
+        I_POP,
+        I_ADD,
+        I_OR,
+        I_AND,
+        I_SUB,
+        I_XOR,
+        I_CMP,
+        I_TEST,
+        I_IMUL,
+        I_NEG,
+        I_NOT,
+        I_IDIV,
+        I_CQO,
+        I_CDQ,
+        I_MOVSB, // Sign-extend a byte
+        I_MOVSW, // Sign-extend a word
+        I_MOVSXD,
+        I_MOVZB, // Zero-extend a byte
+        I_MOVZX, // Zero-extend a register of any size
+        I_JMP,
+        I_CALL,
+        I_RET,
+        I_SETCC,
+        I_JCC,
+} Mnemonic;
+
+static struct {
+        char *name;
+        Mnemonic mnemonic;
+} mnemonics[] = {
+        {"mov", I_MOV}, {"lea", I_LEA}, {"push", I_PUSH}, {"pop", I_POP},
+        {"add", I_ADD}, {"or", I_OR}, {"and", I_AND}, {"sub", I_SUB},
+        {"xor", I_XOR}, {"cmp", I_CMP}, {"test", I_TEST}, {"imul", I_IMUL},
+        {"neg", I_NEG}, {"not", I_NOT}, {"idiv", I_IDIV}, {"cqo", I_CQO},
+        {"cdq", I_CDQ}, {"movsbl", I_MOVSB}, {"movsbq", I_MOVSB}, {"movswl", I_MOVSW},
+        {"movswq", I_MOVSW}, {"movsxd", I_MOVSXD}, {"movslq", I_MOVSXD}, {"movzb", I_MOVZB},
+        {"movzbl", I_MOVZB}, {"movzbq", I_MOVZB}, {"movzx", I_MOVZX}, {"jmp", I_JMP},
+        {"call", I_CALL}, {"ret", I_RET},
+};
+
+static char *condition_codes[] = {
+        "o", "no", "b", "ae", "e", "ne", "be", "a", "s", "ns", "p", "np", "l", "ge", "le", "g",
+};
+
+static int condition_code(char *s) {
+        for (int i = 0; i < 16; i++)
+                if (!strcmp(s, condition_codes[i]))
+                        return i;
+        return -1;
+}
+
+// Finds the mnemonic of `name`, which may carry a size suffix
+static bool find_mnemonic(char *name, Mnemonic *mnemonic, int *size, int *cc) {
+        *size = 0;
+        if (!strncmp(name, "set", 3) && (*cc = condition_code(name + 3)) >= 0) {
+                *mnemonic = I_SETCC;
+                return true;
+        }
+        if (name[0] == 'j' && strcmp(name, "jmp") && (*cc = condition_code(name + 1)) >= 0) {
+                *mnemonic = I_JCC;
+                return true;
+        }
+
+        for (int i = 0; i < (int)(sizeof(mnemonics) / sizeof(*mnemonics)); i++) {
+                if (!strcmp(name, mnemonics[i].name)) {
+                        *mnemonic = mnemonics[i].mnemonic;
+                        return true;
+                }
+        }
+
+        int len = strlen(name);
+        char *suffixes = "bwlq";
+        char *suffix = len > 1 ? strchr(suffixes, name[len - 1]) : NULL;
+        if (!suffix)
+                return false;
+        for (int i = 0; i < (int)(sizeof(mnemonics) / sizeof(*mnemonics)); i++) {
+                if (!strncmp(name, mnemonics[i].name, len - 1) && !mnemonics[i].name[len - 1]) {
+                        *mnemonic = mnemonics[i].mnemonic;
+                        *size = 1 << (suffix - suffixes);
+                        return true;
+                }
+        }
+        return false;
+}
+
+// The operand size of an instruction without a size suffix is that of
+// its register operands
+static int operand_size(Operand *ops, int n, int size) {
+        for (int i = 0; i < n; i++) {
+                if (ops[i].kind != OP_REG)
+                        continue;
+                if (size && size != ops[i].size)
+                        bad_line("operand size mismatch");
+                size = ops[i].size;
+        }
+        if (!size)
+                bad_line("unknown operand size");
+        return size;
+}
+
+static void expect_operands(int n, int expected) {
+        if (n != expected)
+                bad_line("wrong number of operands");
+}
+
+static void expect_reg(Operand *op) {
+        if (op->kind != OP_REG)
+                bad_line("expected a register");
+}
+
+// add, or, and, sub, xor and cmp, numbered by their opcode extension
+static void emit_alu(int ext, Operand *src, Operand *dst, int size) {
+        char op[1];
+        if (src->kind == OP_IMM) {
+                if (dst->kind == OP_MEM && !fits_int32(src->imm))
+                        bad_line("immediate out of range");
+                if (size == 1) {
+                        emit_modrm(size, "\x80", 1, ext, NULL, dst, 1);
+                        emit_bytes(src->imm, 1);
+                } else if (fits_int8(src->imm)) {
+                        emit_modrm(size, "\x83", 1, ext, NULL, dst, 1);
+                        emit_bytes(src->imm, 1);
+                } else {
+                        int imm_size = size == 2 ? 2 : 4;
+                        if (!fits_int32(src->imm))
+                                bad_line("immediate out of range");
+                        emit_modrm(size, "\x81", 1, ext, NULL, dst, imm_size);
+                        emit_bytes(src->imm, imm_size);
+                }
+                return;
+        }
+
+        if (src->kind == OP_REG) {
+                op[0] = ext << 3 | (size == 1 ? 0 : 1);
+                emit_modrm(size, op, 1, src->reg, src, dst, 0);
+                return;
+        }
+
+        expect_reg(dst);
+        op[0] = ext << 3 | (size == 1 ? 2 : 3);
+        emit_modrm(size, op, 1, dst->reg, dst, src, 0);
+}
+
+static void emit_mov(Operand *src, Operand *dst, int size) {
+        if (src->kind == OP_IMM && dst->kind == OP_REG) {
+                // A 64-bit immediate that is not a sign-extended 32-bit
+                // one needs movabs
+                if (size == 8 && fits_int32(src->imm)) {
+                        emit_modrm(8, "\xC7", 1, 0, NULL, dst, 4);
+                        emit_bytes(src->imm, 4);
+                        return;
+                }
+                int rex = (size == 8 ? 8 : 0) | (dst->reg & 8 ? 1 : 0);
+                if (size == 2)
+                        emit_byte(0x66);
+                if (rex || needs_rex(dst))
+                        emit_byte(0x40 | rex);
+                emit_byte((size == 1 ? 0xB0 : 0xB8) + (dst->reg & 7));
+                emit_bytes(src->imm, size);
+                return;
+        }
+
+        if (src->kind == OP_IMM) {
+                int imm_size = size == 8 ? 4 : size;
+                if (!fits_int32(src->imm))
+                        bad_line("immediate out of range");
+                emit_modrm(size, size == 1 ? "\xC6" : "\xC7", 1, 0, NULL, dst, imm_size);
+                emit_bytes(src->imm, imm_size);
+                return;
+        }
+
+        if (src->kind == OP_REG) {
+                emit_modrm(size, size == 1 ? "\x88" : "\x89", 1, src->reg, src, dst, 0);
+                return;
+        }
+
+        expect_reg(dst);
+        emit_modrm(size, size == 1 ? "\x8A" : "\x8B", 1, dst->reg, dst, src, 0);
+}
+
+// A jump or call to a label
+static void emit_branch(char *opcode, int oplen, Operand *target, uint32_t type) {
+        if (target->kind != OP_SYM)
+                bad_line("expected a label");
+        for (int i = 0; i < oplen; i++)
+                emit_byte((unsigned char)opcode[i]);
+        emit_pcrel(target->sym, -4, type);
+}
+
+static void assemble_insn(char *name, Operand *ops, int n) {
+        Mnemonic mnemonic;
+        int size, cc;
+        if (!find_mnemonic(name, &mnemonic, &size, &cc))
+                bad_line("unknown instruction");
+
+        switch (mnemonic) {
+                case I_MOV:
+                        expect_operands(n, 2);
+                        emit_mov(&ops[0], &ops[1], operand_size(ops, 2, size));
+                        return;
+                case I_LEA:
+                        expect_operands(n, 2);
+                        expect_reg(&ops[1]);
+                        if (ops[0].kind != OP_MEM)
+                                bad_line("expected a memory operand");
+                        emit_modrm(ops[1].size, "\x8D", 1, ops[1].reg, &ops[1], &ops[0], 0);
+                        return;
+                case I_PUSH:
+                case I_POP:
+                        expect_operands(n, 1);
+                        expect_reg(&ops[0]);
+                        if (ops[0].size != 8)
+                                bad_line("expected a 64-bit register");
+                        if (ops[0].reg & 8)
+                                emit_byte(0x41);
+                        emit_byte((mnemonic == I_PUSH ? 0x50 : 0x58) + (ops[0].reg & 7));
+                        return;
+                case I_ADD:
+                case I_OR:
+                case I_AND:
+                case I_SUB:
+                case I_XOR:
+                case I_CMP: {
+                                static int ext[] = {[I_ADD] = 0, [I_OR] = 1, [I_AND] = 4, [I_SUB] = 5, [I_XOR] = 6, [I_CMP] = 7};
+                                expect_operands(n, 2);
+                                emit_alu(ext[mnemonic], &ops[0], &ops[1], operand_size(ops, 2, size));
+                                return;
+                        }
+                case I_TEST:
+                        expect_operands(n, 2);
+                        expect_reg(&ops[0]);
+                        size = operand_size(ops, 2, size);
+                        emit_modrm(size, size == 1 ? "\x84" : "\x85", 1, ops[0].reg, &ops[0], &ops[1], 0);
+                        return;
+                case I_IMUL:
+                        expect_operands(n, 2);
+                        expect_reg(&ops[1]);
+                        size = operand_size(ops, 2, size);
+                        if (size == 1)
+                                bad_line("8-bit imul");
+                        if (ops[0].kind == OP_IMM) {
+                                if (fits_int8(ops[0].imm)) {
+                                        emit_modrm(size, "\x6B", 1, ops[1].reg, &ops[1], &ops[1], 1);
+                                        emit_bytes(ops[0].imm, 1);
+                                } else {
+                                        int imm_size = size == 2 ? 2 : 4;
+                                        if (!fits_int32(ops[0].imm))
+                                                bad_line("immediate out of range");
+                                        emit_modrm(size, "\x69", 1, ops[1].reg, &ops[1], &ops[1], imm_size);
+                                        emit_bytes(ops[0].imm, imm_size);
+                                }
+                                return;
+                        }
+                        emit_modrm(size, "\x0F\xAF", 2, ops[1].reg, &ops[1], &ops[0], 0);
+                        return;
+                case I_NEG:
+                case I_NOT:
+                case I_IDIV: {
+                                static int ext[] = {[I_NEG] = 3, [I_NOT] = 2, [I_IDIV] = 7};
+                                expect_operands(n, 1);
+                                size = operand_size(ops, 1, size);
+                                emit_modrm(size, size == 1 ? "\xF6" : "\xF7", 1, ext[mnemonic], NULL, &ops[0], 0);
+                                return;
+                        }
+                case I_CQO:
+                        expect_operands(n, 0);
+                        emit_byte(0x48);
+                        emit_byte(0x99);
+                        return;
+                case I_CDQ:
+                        expect_operands(n, 0);
+                        emit_byte(0x99);
+                        return;
+                case I_MOVSB:
+                case I_MOVSW:
+                case I_MOVZB:
+                case I_MOVZX: {
+                                expect_operands(n, 2);
+                                expect_reg(&ops[1]);
+                                int from = mnemonic == I_MOVSW ? 2 : mnemonic == I_MOVZX ? ops[0].size : 1;
+                                if (mnemonic == I_MOVZX && ops[0].kind != OP_REG)
+                                        bad_line("movzx needs a register source");
+                                if (ops[0].kind == OP_REG && ops[0].size != from)
+                                        bad_line("operand size mismatch");
+                                bool sign = mnemonic == I_MOVSB || mnemonic == I_MOVSW;
+                                char opcode[] = {0x0F, (sign ? 0xBE : 0xB6) + (from == 2)};
+                                emit_modrm(ops[1].size, opcode, 2, ops[1].reg, &ops[1], &ops[0], 0);
+                                return;
+                        }
+                case I_MOVSXD:
+                        expect_operands(n, 2);
+                        expect_reg(&ops[1]);
+                        if (ops[1].size != 8 || (ops[0].kind == OP_REG && ops[0].size != 4))
+                                bad_line("operand size mismatch");
+                        emit_modrm(8, "\x63", 1, ops[1].reg, &ops[1], &ops[0], 0);
+                        return;
+                case I_SETCC: {
+                                expect_operands(n, 1);
+                                if (operand_size(ops, 1, 1) != 1)
+                                        bad_line("expected an 8-bit operand");
+                                char opcode[] = {0x0F, 0x90 + cc};
+                                emit_modrm(1, opcode, 2, 0, NULL, &ops[0], 0);
+                                return;
+                        }
+                case I_JCC: {
+                                expect_operands(n, 1);
+                                char opcode[] = {0x0F, 0x80 + cc};
+                                emit_branch(opcode, 2, &ops[0], R_X86_64_PC32);
+                                return;
+                        }
+                case I_JMP:
+                        expect_operands(n, 1);
+                        emit_branch("\xE9", 1, &ops[0], R_X86_64_PC32);
+                        return;
+                case I_CALL:
+                        expect_operands(n, 1);
+                        emit_branch("\xE8", 1, &ops[0], R_X86_64_PLT32);
+                        return;
+                case I_RET:
+                        expect_operands(n, 0);
+                        emit_byte(0xC3);
+                        return;
+        }
+        unreachable();
+}
+
+// Lines
+
+static char *skip_spaces(char *p) {
+        while (*p == ' ' || *p == '\t')
+                p++;
+        return p;
+}
+
+static Symbol *symbol_operand(char *arg) {
+        char *end = arg;
+        while (is_symbol_char(*end))
+                end++;
+        if (end == arg || *skip_spaces(end))
+                bad_line("expected a symbol");
+        return get_symbol(arg, end - arg);
+}
+
+static void assemble_directive(char *name, char *arg) {
+        if (!strcmp(name, ".file") || !strcmp(name, ".loc"))
+                return;
+
+        if (!strcmp(name, ".text")) {
+                current = SEC_TEXT;
+                return;
+        }
+        if (!strcmp(name, ".data")) {
+                current = SEC_DATA;
+                return;
+        }
+        if (!strcmp(name, ".bss")) {
+                current = SEC_BSS;
+                return;
+        }
+        if (!strcmp(name, ".section")) {
+                for (int i = 1; i < SEC_COUNT; i++) {
+                        if (!strcmp(arg, sections[i].name)) {
+                                current = i;
+                                return;
+                        }
+                }
+                bad_line("unknown section");
+        }
+
+        if (!strcmp(name, ".globl")) {
+                symbol_operand(arg)->is_global = true;
+                return;
+        }
+        if (!strcmp(name, ".local")) {
+                symbol_operand(arg)->is_global = false;
+                return;
+        }
+
+        if (!strcmp(name, ".byte")) {
+                char *end;
+                emit_byte(parse_number(arg, &end));
+                if (*skip_spaces(end))
+                        bad_line("bad number");
+                return;
+        }
+        if (!strcmp(name, ".zero")) {
+                char *end;
+                long n = parse_number(arg, &end);
+                if (n < 0 || *skip_spaces(end))
+                        bad_line("bad size");
+                if (current == SEC_BSS) {
+                        sections[SEC_BSS].size += n;
+                        return;
+                }
+                for (long i = 0; i < n; i++)
+                        emit_byte(0);
+                return;
+        }
+        bad_line("unknown directive");
+}
+
+#define MAX_OPERANDS 3
+
+static void assemble_line(char *line) {
+        current_line = line;
+        char *p = skip_spaces(line);
+        if (!*p)
+                return;
+
+        size_t len = strlen(p);
+        if (p[len - 1] == ':') {
+                Symbol *sym = get_symbol(p, len - 1);
+                if (sym->section)
+                        bad_line("symbol redefined");
+                sym->section = current;
+                sym->value = sections[current].size;
+                return;
+        }
+
+        char *name = p;
+        while (*p && *p != ' ' && *p != '\t')
+                p++;
+        if (*p)
+                *p++ = '\0';
+        p = skip_spaces(p);
+
+        if (*name == '.') {
+                assemble_directive(name, p);
+                return;
+        }
+
+        // Operands are separated by commas outside of parentheses
+        Operand ops[MAX_OPERANDS];
+        int n = 0;
+        while (*p) {
+                char *start = p;
+                int parens = 0;
+                for (; *p && (parens || *p != ','); p++)
+                        parens += (*p == '(') - (*p == ')');
+                char *end = p;
+                while (end > start && end[-1] == ' ')
+                        end--;
+                if (*p)
+                        p = skip_spaces(p + 1);
+                *end = '\0';
+                if (n == MAX_OPERANDS)
+                        bad_line("too many operands");
+                parse_operand(start, &ops[n++]);
+        }
+        assemble_insn(name, ops, n);
+}
+
+// Writing the object file
+
+static bool is_temporary(Symbol *sym) {
+        return !strncmp(sym->name, ".L", 2);
+}
+
+static void add_reloc(Section *sec, long offset, int sym_index, uint32_t type, long addend) {
+        if (sec->reloc_count == sec->reloc_cap) {
+                sec->reloc_cap = sec->reloc_cap ? sec->reloc_cap * 2 : 64;
+                sec->relocs = realloc(sec->relocs, sizeof(Elf64_Rela) * sec->reloc_cap);
+        }
+        sec->relocs[sec->reloc_count++] = (Elf64_Rela){offset, ELF64_R_INFO(sym_index, type), addend};
+}
+
+// Fills in the fields that refer to a place in their own section and
+// turns the others into relocations. Symbols that are not global are
+// relocated against their section, as other assemblers do.
+static void resolve_fixups(void) {
+        for (int i = 0; i < fixup_count; i++) {
+                Fixup *fix = &fixups[i];
+                Symbol *sym = fix->sym;
+                Section *sec = &sections[fix->section];
+
+                if (sym->section && !sym->is_global && sym->section == fix->section) {
+                        int32_t val = sym->value + fix->addend - fix->offset;
+                        memcpy(sec->data.buf + fix->offset, &val, 4);
+                } else if (sym->section && !sym->is_global) {
+                        add_reloc(sec, fix->offset, sym->section, R_X86_64_PC32, sym->value + fix->addend);
+                } else {
+                        if (!sym->section && is_temporary(sym))
+                                error("assembler: undefined label: %s", sym->name);
+                        add_reloc(sec, fix->offset, sym->index, fix->type, fix->addend);
+                }
+        }
+}
+
+static int add_string(Output *strtab, char *s) {
+        int offset = strtab->len;
+        out_write(strtab, s, strlen(s) + 1);
+        return offset;
+}
+
+static bool is_global_symbol(Symbol *sym) {
+        return sym->is_global || !sym->section;
+}
+
+// Labels starting with .L stay out of the symbol table unless they are
+// global, and so do symbols that are only named by a .local
+static bool in_symtab(Symbol *sym) {
+        if (sym->is_global)
+                return true;
+        if (!sym->section)
+                return sym->is_referenced;
+        return !is_temporary(sym);
+}
+
+// The symbol table starts with the null symbol and one symbol per
+// section, followed by the local and then the global symbols. Returns
+// the index of the first global symbol.
+static int build_symtab(Output *symtab, Output *strtab) {
+        out_putc(strtab, '\0');
+        Elf64_Sym null = {};
+        out_write(symtab, (char *)&null, sizeof(null));
+        for (int i = 1; i < SEC_COUNT; i++) {
+                Elf64_Sym sym = {.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION), .st_shndx = i};
+                out_write(symtab, (char *)&sym, sizeof(sym));
+        }
+
+        int index = SEC_COUNT;
+        int first_global = 0;
+        for (int global = 0; global < 2; global++) {
+                if (global)
+                        first_global = index;
+                for (int i = 0; i < symbol_count; i++) {
+                        Symbol *s = symbol_list[i];
+                        if (is_global_symbol(s) != global || !in_symtab(s))
+                                continue;
+                        Elf64_Sym sym = {
+                                .st_name = add_string(strtab, s->name),
+                                .st_info = ELF64_ST_INFO(global ? STB_GLOBAL : STB_LOCAL, STT_NOTYPE),
+                                .st_shndx = s->section,
+                                .st_value = s->value,
+                        };
+                        out_write(symtab, (char *)&sym, sizeof(sym));
+                        s->index = index++;
+                }
+        }
+        return first_global;
+}
+
+typedef struct {
+        char *name;
+        Elf64_Shdr header;
+        char *contents;
+} ObjectSection;
+
+#define MAX_OBJECT_SECTIONS (SEC_COUNT * 2 + 4)
+
+static int add_object_section(ObjectSection *list, int count, char *name, uint32_t type, uint64_t flags,
+                char *contents, size_t size, size_t entsize) {
+        list[count] = (ObjectSection){name, {.sh_type = type, .sh_flags = flags, .sh_size = size,
+                .sh_addralign = entsize ? 8 : 1, .sh_entsize = entsize}, contents};
+        return count + 1;
+}
+
+static void write_object(char *path) {
+        Output symtab = {.fd = -1}, strtab = {.fd = -1}, shstrtab = {.fd = -1};
+        int first_global = build_symtab(&symtab, &strtab);
+        resolve_fixups();
+
+        ObjectSection list[MAX_OBJECT_SECTIONS] = {};
+        int count = 1;
+        for (int i = 1; i < SEC_COUNT; i++) {
+                Section *sec = &sections[i];
+                count = add_object_section(list, count, sec->name, sec->type, sec->flags, sec->data.buf, sec->size, 0);
+        }
+
+        int rela_count = 0;
+        for (int i = 1; i < SEC_COUNT; i++)
+                rela_count += sections[i].reloc_count > 0;
+        int symtab_index = count + rela_count;
+        for (int i = 1; i < SEC_COUNT; i++) {
+                Section *sec = &sections[i];
+                if (!sec->reloc_count)
+                        continue;
+                count = add_object_section(list, count, format(".rela%s", sec->name), SHT_RELA, SHF_INFO_LINK,
+                                (char *)sec->relocs, sizeof(Elf64_Rela) * sec->reloc_count, sizeof(Elf64_Rela));
+                list[count - 1].header.sh_link = symtab_index;
+                list[count - 1].header.sh_info = i;
+        }
+
+        count = add_object_section(list, count, ".symtab", SHT_SYMTAB, 0, symtab.buf, symtab.len, sizeof(Elf64_Sym));
+        list[count - 1].header.sh_link = count;
+        list[count - 1].header.sh_info = first_global;
+        count = add_object_section(list, count, ".strtab", SHT_STRTAB, 0, strtab.buf, strtab.len, 0);
+        // An empty .note.GNU-stack asks for a non-executable stack
+        count = add_object_section(list, count, ".note.GNU-stack", SHT_PROGBITS, 0, NULL, 0, 0);
+        int shstrtab_index = count;
+        count = add_object_section(list, count, ".shstrtab", SHT_STRTAB, 0, NULL, 0, 0);
+
+        out_putc(&shstrtab, '\0');
+        for (int i = 1; i < count; i++)
+                list[i].header.sh_name = add_string(&shstrtab, list[i].name);
+        list[shstrtab_index].contents = shstrtab.buf;
+        list[shstrtab_index].header.sh_size = shstrtab.len;
+
+        // Contents follow the ELF header, each at an 8-byte boundary,
+        // and the section headers come last
+        long offset = sizeof(Elf64_Ehdr);
+        for (int i = 1; i < count; i++) {
+                offset = align_to(offset, 8);
+                list[i].header.sh_offset = offset;
+                if (list[i].header.sh_type != SHT_NOBITS)
+                        offset += list[i].header.sh_size;
+        }
+        long shoff = align_to(offset, 8);
+
+        Elf64_Ehdr ehdr = {
+                .e_ident = {ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64, ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV},
+                .e_type = ET_REL,
+                .e_machine = EM_X86_64,
+                .e_version = EV_CURRENT,
+                .e_shoff = shoff,
+                .e_ehsize = sizeof(Elf64_Ehdr),
+                .e_shentsize = sizeof(Elf64_Shdr),
+                .e_shnum = count,
+                .e_shstrndx = shstrtab_index,
+        };
+
+        static char padding[8];
+        Output *out = out_open(path);
+        out_write(out, (char *)&ehdr, sizeof(ehdr));
+        long pos = sizeof(ehdr);
+        for (int i = 1; i < count; i++) {
+                Elf64_Shdr *header = &list[i].header;
+                if (header->sh_type == SHT_NOBITS || !header->sh_size)
+                        continue;
+                out_write(out, padding, header->sh_offset - pos);
+                out_write(out, list[i].contents, header->sh_size);
+                pos = header->sh_offset + header->sh_size;
+        }
+        out_write(out, padding, shoff - pos);
+        for (int i = 0; i < count; i++)
+                out_write(out, (char *)&list[i].header, sizeof(Elf64_Shdr));
+        out_close(out);
+
+        free(symtab.buf);
+        free(strtab.buf);
+        free(shstrtab.buf);
+}
+
+static void assemble_text(char *text, size_t len) {
+        init_sections();
+
+        char *line = malloc(256);
+        size_t line_cap = 256;
+        for (char *p = text, *end = text + len; p < end;) {
+                char *nl = memchr(p, '\n', end - p);
+                size_t n = (nl ? nl : end) - p;
+                if (n + 1 > line_cap) {
+                        line_cap = n + 1;
+                        line = realloc(line, line_cap);
+                }
+                memcpy(line, p, n);
+                line[n] = '\0';
+                assemble_line(line);
+                p += n + 1;
+        }
+        free(line);
+        current_line = NULL;
+}
+
+static void reset_assembler(void) {
+        for (int i = 1; i < SEC_COUNT; i++) {
+                free(sections[i].data.buf);
+                free(sections[i].relocs);
+        }
+        free(symbols);
+        free(symbol_list);
+        free(fixups);
+        symbols = symbol_list = NULL;
+        fixups = NULL;
+        symbol_cap = symbol_count = 0;
+        fixup_count = fixup_cap = 0;
+}
+
+// Assembles the `len` bytes of assembly at `text` into the object file
+// `path`
+void assemble(char *text, size_t len, char *path) {
+        assemble_text(text, len);
+        write_object(path);
+        reset_assembler();
+}
+
+// Running in memory
+
+#define PAGE_SIZE 4096
+
+// External functions may be further away than a call reaches, so calls
+// go through a stub: jmp *0(%rip) followed by the function's address
+#define STUB_SIZE 16
+
+// Makes the symbols of the shared library `path` available to --run
+void load_library(char *path) {
+        if (!dlopen(path, RTLD_NOW | RTLD_GLOBAL))
+                error("cannot load %s: %s", path, dlerror());
+}
+
+// Looks up a symbol of the compiler process and the libraries it has
+// loaded, which include the C library
+static char *find_external(char *name) {
+        static void *process;
+        if (!process)
+                process = dlopen(NULL, RTLD_NOW);
+        char *addr = dlsym(process, name);
+        if (!addr)
+                error("undefined symbol: %s", name);
+        return addr;
+}
+
+// Assembles `text` into memory and calls its main() with `argc` and
+// `argv`. The code and the stubs, the read-only data and the writable
+// data each start on a page of one mapping; the code is made executable
+// and the read-only data read-only once everything is in place.
+int run_assembly(char *text, size_t len, int argc, char **argv) {
+        assemble_text(text, len);
+
+        // Undefined symbols are numbered in `index` for their stubs
+        int stub_count = 0;
+        for (int i = 0; i < symbol_count; i++)
+                if (!symbol_list[i]->section && symbol_list[i]->is_referenced)
+                        symbol_list[i]->index = stub_count++;
+
+        long stubs_start = sections[SEC_TEXT].size;
+        long rodata_start = align_to(stubs_start + stub_count * STUB_SIZE, PAGE_SIZE);
+        long data_start = align_to(rodata_start + sections[SEC_RODATA].size, PAGE_SIZE);
+        long bss_start = data_start + sections[SEC_DATA].size;
+        long size = align_to(bss_start + sections[SEC_BSS].size, PAGE_SIZE);
+
+        char *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+                error("cannot map memory for the program: %s", strerror(errno));
+        char *start[SEC_COUNT] = {
+                [SEC_TEXT] = base,
+                [SEC_RODATA] = base + rodata_start,
+                [SEC_DATA] = base + data_start,
+                [SEC_BSS] = base + bss_start,
+        };
+        for (int i = 1; i < SEC_COUNT; i++)
+                if (i != SEC_BSS && sections[i].size)
+                        memcpy(start[i], sections[i].data.buf, sections[i].size);
+
+        char **externals = calloc(stub_count + 1, sizeof(char *));
+        for (int i = 0; i < symbol_count; i++) {
+                Symbol *sym = symbol_list[i];
+                if (sym->section || !sym->is_referenced)
+                        continue;
+                char *addr = find_external(sym->name);
+                char *stub = base + stubs_start + sym->index * STUB_SIZE;
+                memcpy(stub, "\xFF\x25\0\0\0\0", 6);
+                memcpy(stub + 6, &addr, 8);
+                externals[sym->index] = addr;
+        }
+
+        for (int i = 0; i < fixup_count; i++) {
+                Fixup *fix = &fixups[i];
+                Symbol *sym = fix->sym;
+                char *field = start[fix->section] + fix->offset;
+                char *target;
+                if (sym->section)
+                        target = start[sym->section] + sym->value;
+                else if (fix->type == R_X86_64_PLT32)
+                        target = base + stubs_start + sym->index * STUB_SIZE;
+                else
+                        target = externals[sym->index];
+
+                long val = target + fix->addend - field;
+                if (val != (int32_t)val)
+                        error("%s is out of reach of the program", sym->name);
+                int32_t val32 = val;
+                memcpy(field, &val32, 4);
+        }
+        free(externals);
+
+        Symbol *main_sym = get_symbol("main", 4);
+        if (main_sym->section != SEC_TEXT)
+                error("no main function");
+        int (*entry)(int, char **) = (int (*)(int, char **))(start[SEC_TEXT] + main_sym->value);
+        reset_assembler();
+
+        if (mprotect(base, rodata_start, PROT_READ | PROT_EXEC) ||
+                        (data_start > rodata_start && mprotect(base + rodata_start, data_start - rodata_start, PROT_READ)))
+                error("cannot protect the program: %s", strerror(errno));
+        return entry(argc, argv);
+}
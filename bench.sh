@@ -0,0 +1,341 @@
+#!/bin/bash
+# Compiler benchmarks. Every section generates a large input, feeds it
+# to ./main with --time-report and prints how long the phase it is
+# about took. Run all sections with `./bench.sh` or pick some with
+# `./bench.sh lex ...`. The input size can be scaled with SCALE=<n>.
+
+tmp=`mktemp -d /tmp/compiler-bench-XXXXXX`
+trap 'rm -rf $tmp' INT TERM HUP EXIT
+
+make -s main || exit 1
+
+scale=${SCALE:-1}
+runs=${RUNS:-3}
+
+# best_ms <phase> <command...>
+# Runs a command $runs times and prints the fastest time of a phase
+best_ms() {
+        phase=$1
+        shift
+        best=
+        for i in `seq $runs`; do
+                ms=`"$@" 2>&1 >/dev/null | awk -v p=$phase '$1 == p { print $2 }'`
+                if [ -z "$best" ] || awk -v a=$ms -v b=$best 'BEGIN { exit !(a < b) }'; then
+                        best=$ms
+                fi
+        done
+        echo $best
+}
+
+# mbps <bytes> <ms>
+mbps() {
+        awk -v b=$1 -v ms=$2 'BEGIN { printf "%8.1f MB/s", b / 1048576 / (ms / 1000) }'
+}
+
+# gen_functions <n>
+# Machine-generated looking code: long identifiers, indentation, comments
+gen_functions() {
+        awk -v n=$1 'BEGIN {
+                for (i = 0; i < n; i++) {
+                        printf "int generated_helper_function_%d(int first_argument, int second_argument) {\n", i
+                        printf "        /* accumulate the intermediate value */\n"
+                        printf "        int accumulated_intermediate_value = first_argument + second_argument * 3;\n"
+                        printf "        accumulated_intermediate_value = accumulated_intermediate_value - %d;\n", i
+                        printf "        return accumulated_intermediate_value; // done\n"
+                        printf "}\n\n"
+                }
+        }'
+}
+
+bench_lex() {
+        gen_functions $((5000 * scale)) > $tmp/lex.c
+        bytes=`stat -c %s $tmp/lex.c`
+        echo "lex: $bytes bytes"
+
+        ms=`best_ms tokenize ./main --time-report -o /dev/null $tmp/lex.c`
+        echo "  file (mmap)   $ms ms `mbps $bytes $ms`"
+
+        ms=`best_ms tokenize sh -c "./main --time-report -o /dev/null - < $tmp/lex.c"`
+        echo "  stdin (copy)  $ms ms `mbps $bytes $ms`"
+}
+
+# 50k file-scope declarations followed by functions that look names up
+bench_scope() {
+        n=$((50000 * scale))
+        awk -v n=$n 'BEGIN {
+                for (i = 0; i < n; i++)
+                        printf "int global_variable_%d;\n", i
+                for (i = 0; i < n; i += 50) {
+                        printf "int use_%d() {\n", i
+                        printf "        int local = global_variable_%d;\n", i
+                        printf "        return local + global_variable_%d + global_variable_%d;\n", n - 1 - i, i / 2
+                        printf "}\n"
+                }
+        }' > $tmp/scope.c
+        echo "scope: $n global declarations"
+
+        ms=`best_ms parse ./main --time-report -o /dev/null $tmp/scope.c`
+        echo "  parse         $ms ms"
+}
+
+# One function with well over 100k AST nodes
+bench_ast() {
+        n=$((20000 * scale))
+        awk -v n=$n 'BEGIN {
+                printf "int main() {\n        int x = 0;\n        int y = 1;\n"
+                for (i = 0; i < n; i++)
+                        printf "        if (x < %d) x = x + y * %d - (x / 3); else y = y + 1;\n", i, i % 7
+                printf "        return x;\n}\n"
+        }' > $tmp/ast.c
+        echo "ast: one function with $n statements"
+
+        ms=`best_ms parse ./main --time-report -o /dev/null $tmp/ast.c`
+        echo "  parse         $ms ms"
+        ms=`best_ms codegen ./main --time-report -o /dev/null $tmp/ast.c`
+        echo "  codegen       $ms ms"
+        ./main --mem-stats -o /dev/null $tmp/ast.c 2>&1 | awk '$1 == "ast" { print "  ast memory    " $2 " bytes" }'
+}
+
+# A guarded header with 2000 prototypes included 1000 times
+bench_pp() {
+        awk 'BEGIN {
+                print "#ifndef BENCH_H\n#define BENCH_H"
+                for (i = 0; i < 2000; i++)
+                        printf "int prototype_%d(int first, int second);\n", i
+                print "#endif"
+        }' > $tmp/bench.h
+        for i in `seq 1000`; do echo '#include "bench.h"'; done > $tmp/pp.c
+        echo 'int main() { return 0; }' >> $tmp/pp.c
+        echo "pp: header included 1000 times"
+
+        ms=`best_ms preprocess ./main --time-report -o /dev/null $tmp/pp.c`
+        echo "  preprocess    $ms ms"
+}
+
+# A 4000 declaration prelude parsed from source versus loaded precompiled
+bench_pch() {
+        awk 'BEGIN {
+                for (i = 0; i < 1000; i++) {
+                        printf "typedef struct record_%d { struct record_%d *next; int key; char name[16]; } Record%d;\n", i, i, i
+                        printf "typedef Record%d *RecordPtr%d;\n", i, i
+                        printf "int record_compare_%d(Record%d *first, Record%d *second);\n", i, i, i
+                        printf "RecordPtr%d record_lookup_%d(RecordPtr%d table, int key);\n", i, i, i
+                }
+        }' > $tmp/prelude.h
+        echo 'int main() { Record7 r; r.key = 3; return r.key; }' > $tmp/pch.c
+        (echo '#include "prelude.h"'; cat $tmp/pch.c) > $tmp/include.c
+        ./main --emit-pch -o $tmp/prelude.pch $tmp/prelude.h || exit 1
+        echo "pch: prelude with 4000 declarations"
+
+        ms=`best_ms total ./main --time-report -o /dev/null $tmp/include.c`
+        echo "  #include      $ms ms"
+        ms=`best_ms total ./main --time-report --include-pch $tmp/prelude.pch -o /dev/null $tmp/pch.c`
+        echo "  --include-pch $ms ms"
+}
+
+# ms <command...>
+# Prints the wall time of a command
+ms() {
+        start=`date +%s%N`
+        "$@" > /dev/null
+        echo $(((`date +%s%N` - start) / 1000000))
+}
+
+# 5000 functions generated serially and on a thread per core
+bench_codegen() {
+        gen_functions $((5000 * scale)) > $tmp/codegen.c
+        echo "codegen: $((5000 * scale)) functions"
+
+        for jobs in 1 `nproc`; do
+                printf "  %-13s %s ms\n" "-j $jobs" `best_ms codegen ./main --time-report -j $jobs -o /dev/null $tmp/codegen.c`
+        done
+}
+
+# Parsing and codegen one after the other and overlapped
+bench_pipeline() {
+        gen_functions $((5000 * scale)) > $tmp/pipeline.c
+        echo "pipeline: $((5000 * scale)) functions"
+
+        printf "  %-13s %s ms\n" serial `best_ms total ./main --time-report -o /dev/null $tmp/pipeline.c`
+        printf "  %-13s %s ms\n" --pipeline `best_ms total ./main --time-report --pipeline -o /dev/null $tmp/pipeline.c`
+}
+
+# Peak memory of a large file compiled whole and a function at a time
+bench_stream() {
+        gen_functions $((20000 * scale)) > $tmp/stream.c
+        echo "stream: $((20000 * scale)) functions"
+
+        for mode in "" --stream; do
+                peak=`./main $mode --mem-stats -o /dev/null $tmp/stream.c 2>&1 | awk '$1 == "total" { print $8 }'`
+                printf "  %-13s %s bytes peak\n" "${mode:-whole file}" $peak
+        done
+}
+
+# 5000 static helpers of which main only calls one
+bench_lazy() {
+        gen_functions $((5000 * scale)) | sed 's/^int generated/static int generated/' > $tmp/lazy.c
+        echo 'int main() { return generated_helper_function_7(1, 2); }' >> $tmp/lazy.c
+        echo "lazy: $((5000 * scale)) static functions, 1 called"
+
+        for mode in "" --lazy-bodies; do
+                printf "  %-13s %s ms\n" "${mode:-eager}" `best_ms total ./main --time-report $mode -o /dev/null $tmp/lazy.c`
+        done
+}
+
+# Operator-heavy statements of 46 tokens each
+bench_expr() {
+        n=$((20000 * scale))
+        awk -v n=$n 'BEGIN {
+                printf "int main() {\n        int a = 1; int b = 2; int c = 3; int d = 4; int e = 5; int f = 6; int x = 0;\n"
+                for (i = 0; i < n; i++)
+                        printf "        x = (a + b * c - d / e) %% f + (a < b) + (a == c && b != d || e > f) - (a & b | c ^ d);\n"
+                printf "        return x;\n}\n"
+        }' > $tmp/expr.c
+        echo "expr: $((46 * n)) expression tokens"
+
+        ms=`best_ms parse ./main --time-report -o /dev/null $tmp/expr.c`
+        echo "  parse         $ms ms `awk -v ms=$ms -v t=$((46 * n)) 'BEGIN { printf "%8.1f ns/token", ms * 1000000 / t }'`"
+}
+
+# best_wall_ms <command...>
+# Runs a command $runs times and prints the fastest wall time
+best_wall_ms() {
+        best=
+        for i in `seq $runs`; do
+                t=`ms "$@"`
+                if [ -z "$best" ] || [ $t -lt $best ]; then
+                        best=$t
+                fi
+        done
+        echo $best
+}
+
+# Run time of compute kernels compiled at -O0 and -O1
+bench_kernels() {
+        cat > $tmp/fib.c <<EOF
+int fib(int n) { if (n < 2) return n; return fib(n - 1) + fib(n - 2); }
+int main() { return fib(35) % 256; }
+EOF
+        cat > $tmp/sieve.c <<EOF
+char composite[2000000];
+int main() {
+        int count = 0;
+        for (int round = 0; round < 10; round++) {
+                count = 0;
+                for (int i = 0; i < 2000000; i++)
+                        composite[i] = 0;
+                for (int i = 2; i < 2000000; i++) {
+                        if (!composite[i]) {
+                                count++;
+                                for (int j = i + i; j < 2000000; j += i)
+                                        composite[j] = 1;
+                        }
+                }
+        }
+        return count % 256;
+}
+EOF
+        cat > $tmp/matmul.c <<EOF
+int a[200][200];
+int b[200][200];
+int c[200][200];
+int main() {
+        for (int i = 0; i < 200; i++)
+                for (int j = 0; j < 200; j++) {
+                        a[i][j] = i + j;
+                        b[i][j] = i - j;
+                }
+        for (int i = 0; i < 200; i++)
+                for (int j = 0; j < 200; j++) {
+                        int sum = 0;
+                        for (int k = 0; k < 200; k++)
+                                sum += a[i][k] * b[k][j];
+                        c[i][j] = sum;
+                }
+        return c[123][45] % 256;
+}
+EOF
+        cat > $tmp/collatz.c <<EOF
+int main() {
+        long steps = 0;
+        for (long n = 1; n < 300000; n++) {
+                long x = n;
+                while (x != 1) {
+                        if (x % 2 == 0)
+                                x = x / 2;
+                        else
+                                x = 3 * x + 1;
+                        steps++;
+                }
+        }
+        return steps % 256;
+}
+EOF
+        echo "kernels: run time of the generated code"
+
+        for kernel in fib sieve matmul collatz; do
+                for level in 0 1; do
+                        ./main -O$level -o $tmp/$kernel$level.s $tmp/$kernel.c &&
+                                gcc -o $tmp/$kernel$level $tmp/$kernel$level.s 2>/dev/null || exit 1
+                done
+                printf "  %-13s %6s ms -O0 %6s ms -O1\n" $kernel \
+                        `best_wall_ms $tmp/${kernel}0` `best_wall_ms $tmp/${kernel}1`
+        done
+}
+
+# 5000 functions to an object file through as(1) and with -c
+bench_object() {
+        gen_functions $((5000 * scale)) > $tmp/object.c
+        echo "object: $((5000 * scale)) functions"
+
+        printf "  %-13s %s ms\n" "-S + as" `best_wall_ms sh -c "./main -o $tmp/object.s $tmp/object.c && as -o $tmp/object.o $tmp/object.s"`
+        printf "  %-13s %s ms\n" -c `best_wall_ms ./main -c -o $tmp/object.o $tmp/object.c`
+}
+
+# run_each <command...>
+# Compiles and runs every feature test with `<command> <file>`
+run_each() {
+        for f in test/*.c; do
+                [ $f = test/testfile.c ] && continue
+                "$@" $f > /dev/null || exit 1
+        done
+}
+
+build_and_run() {
+        ./main -I test -o $tmp/run.s $1 && gcc -o $tmp/run $tmp/run.s -xc test/common 2>/dev/null && $tmp/run
+}
+
+# The feature tests compiled, linked and run one by one, and run in
+# memory with --run
+bench_run() {
+        gcc -shared -fPIC -o $tmp/common.so -xc test/common
+        echo "run: `ls test/*.c | grep -vc testfile` feature tests"
+
+        printf "  %-13s %s ms\n" "-S + gcc" `best_wall_ms run_each build_and_run`
+        printf "  %-13s %s ms\n" --run `best_wall_ms run_each ./main --run --load $tmp/common.so -I test`
+}
+
+compile_each() {
+        for f in "$@"; do
+                ./main -o ${f%.c}.s $f
+        done
+}
+
+# 1000 small files compiled one process each and in one batch
+bench_batch() {
+        n=$((1000 * scale))
+        mkdir -p $tmp/batch
+        for i in `seq $n`; do
+                gen_functions 20 > $tmp/batch/file$i.c
+        done
+        echo "batch: $n files"
+
+        printf "  %-13s %s ms\n" processes `ms compile_each $tmp/batch/*.c`
+        for jobs in 1 `nproc`; do
+                printf "  %-13s %s ms\n" "-j $jobs" `ms ./main -j $jobs $tmp/batch/*.c`
+        done
+}
+
+for section in ${@:-lex scope ast expr pp pch codegen pipeline stream lazy batch object run kernels}; do
+        bench_$section
+done
@@ -0,0 +1,93 @@
+#include "token.h"
+#include <pthread.h>
+
+// Identifier interning. Every distinct identifier spelling is stored
+// once, so two names are the same if and only if their interned
+// pointers are equal. The lexer interns every identifier token, which
+// lets the parser compare names without looking at their bytes.
+//
+// Atoms are shared by all threads and live as long as the process, so
+// that cached header tokens can be used by any translation unit. Each
+// thread looks names up in a table of its own first, and only takes
+// the lock for names it has not seen before.
+
+typedef struct {
+        char *name; // NUL-terminated interned spelling; NULL if empty
+        int len;
+        uint32_t hash;
+} Atom;
+
+// Open-addressing hash table with linear probing
+typedef struct {
+        Atom *atoms;
+        int capacity;
+        int used;
+} AtomTable;
+
+static _Thread_local AtomTable local_atoms;
+
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+static AtomTable shared_atoms;
+static Arena atom_arena = {"atoms"};
+
+static uint32_t fnv_hash(char *s, int len) {
+        uint32_t hash = 2166136261u;
+        for (int i = 0; i < len; i++)
+                hash = (hash ^ (unsigned char)s[i]) * 16777619u;
+        return hash;
+}
+
+static void rehash(AtomTable *table) {
+        Atom *old = table->atoms;
+        int old_capacity = table->capacity;
+
+        table->capacity = table->capacity ? table->capacity * 2 : 4096;
+        table->atoms = calloc(table->capacity, sizeof(Atom));
+        if (table->atoms == NULL)
+                error("not enough memory in system to allocate identifier table");
+        for (int i = 0; i < old_capacity; i++) {
+                if (!old[i].name)
+                        continue;
+                int j = old[i].hash & (table->capacity - 1);
+                while (table->atoms[j].name)
+                        j = (j + 1) & (table->capacity - 1);
+                table->atoms[j] = old[i];
+        }
+        free(old);
+}
+
+// Returns the slot of `s` in `table`: the atom if it is there, otherwise
+// the empty slot it goes into
+static Atom *find_atom(AtomTable *table, char *s, int len, uint32_t hash) {
+        // Keep the load factor under 1/2
+        if ((table->used + 1) * 2 > table->capacity)
+                rehash(table);
+
+        int i = hash & (table->capacity - 1);
+        for (; table->atoms[i].name; i = (i + 1) & (table->capacity - 1)) {
+                Atom *atom = &table->atoms[i];
+                if (atom->hash == hash && atom->len == len && !memcmp(atom->name, s, len))
+                        return atom;
+        }
+        return &table->atoms[i];
+}
+
+// Returns the unique copy of the `len` bytes at `s`
+char *intern(char *s, int len) {
+        uint32_t hash = fnv_hash(s, len);
+        Atom *atom = find_atom(&local_atoms, s, len, hash);
+        if (atom->name)
+                return atom->name;
+
+        pthread_mutex_lock(&shared_lock);
+        Atom *shared = find_atom(&shared_atoms, s, len, hash);
+        if (!shared->name) {
+                *shared = (Atom){arena_strndup(&atom_arena, s, len), len, hash};
+                shared_atoms.used++;
+        }
+        *atom = *shared;
+        pthread_mutex_unlock(&shared_lock);
+
+        local_atoms.used++;
+        return atom->name;
+}
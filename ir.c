@@ -0,0 +1,658 @@
+#include "token.h"
+
+// Lowers the AST of a function to three-address code for -O1. Every
+// variable is accessed with IR_LOAD and IR_STORE at first; to_ssa() then
+// promotes the scalar locals whose address is never taken to virtual
+// registers. Everything is allocated from ir_arena, which the code
+// generator releases once the function is written out.
+//
+// Expressions are evaluated in the same order as by the stack machine
+// in asmgen.c, right operand first.
+
+// IR generator state is per thread and only lives during gen_ir()
+static _Thread_local IRFunc *ir_func;
+static _Thread_local IRBlock *current_block;
+static _Thread_local IRBlock *last_block;
+static _Thread_local int current_file;
+static _Thread_local int current_line;
+
+// Where an lvalue is: var + offset, or the value of base + offset
+typedef struct {
+        Obj *var;
+        int base;
+        int offset;
+} Address;
+
+static int gen_expr(Node *node);
+static void gen_statement(Node *node);
+
+static int new_vreg(void) {
+        return ++ir_func->vreg_count;
+}
+
+static IRBlock *new_block(void) {
+        return arena_alloc(&ir_arena, sizeof(IRBlock));
+}
+
+// Appends `block` to the function and makes it the one new
+// instructions go to
+static void start_block(IRBlock *block) {
+        block->id = ir_func->block_count++;
+        if (last_block)
+                last_block->next = block;
+        else
+                ir_func->blocks = block;
+        last_block = current_block = block;
+}
+
+static bool is_terminator(IRInst *inst) {
+        return inst && (inst->op == IR_JMP || inst->op == IR_BR || inst->op == IR_RET);
+}
+
+static IRInst *emit(IROp op, int size, int dst, int a, int b) {
+        // Code after a jump or return is unreachable but still needs
+        // a block of its own
+        if (is_terminator(current_block->last))
+                start_block(new_block());
+
+        IRInst *inst = arena_alloc(&ir_arena, sizeof(IRInst));
+        inst->op = op;
+        inst->size = size;
+        inst->file = current_file;
+        inst->line = current_line;
+        inst->dst = dst;
+        inst->a = a;
+        inst->b = b;
+
+        if (current_block->last)
+                current_block->last->next = inst;
+        else
+                current_block->insts = inst;
+        current_block->last = inst;
+        return inst;
+}
+
+static void jump(IRBlock *target) {
+        emit(IR_JMP, 0, 0, 0, 0)->then = target;
+}
+
+// Values of type int and smaller are computed in 32-bit registers,
+// like gen_expr() does
+static int op_size(Type *type) {
+        return type->kind == TY_LONG || type->base ? 8 : 4;
+}
+
+static bool is_imm32(Node *node) {
+        return node->node_type == ND_NUM && node->val == (int32_t)node->val;
+}
+
+static bool is_aggregate(Type *type) {
+        return type->kind == TY_ARRAY || type->kind == TY_STRUCT || type->kind == TY_UNION;
+}
+
+static int gen_imm(int64_t val) {
+        int dst = new_vreg();
+        emit(IR_IMM, 8, dst, 0, 0)->imm = val;
+        return dst;
+}
+
+static int compare_zero(IROp op, int size, int a) {
+        int dst = new_vreg();
+        emit(op, size, dst, a, 0)->imm = 0;
+        return dst;
+}
+
+static Address gen_address(Node *node) {
+        switch (node->node_type) {
+                case ND_VAR:
+                        return (Address){node->var};
+                case ND_DEREF: {
+                                // *(p + constant) becomes a displacement
+                                Node *addr = node->left;
+                                if (addr->node_type == ND_ADD && addr->type->base && is_imm32(addr->right))
+                                        return (Address){NULL, gen_expr(addr->left), addr->right->val};
+                                return (Address){NULL, gen_expr(addr)};
+                        }
+                case ND_COMMA:
+                        gen_expr(node->left);
+                        return gen_address(node->right);
+                case ND_MEMBER: {
+                                Address addr = gen_address(node->left);
+                                addr.offset += node->member->offset;
+                                return addr;
+                        }
+        }
+
+        error_tok(node->token, "not a local variable");
+}
+
+static IRInst *emit_access(IROp op, int size, int dst, Address addr, int b) {
+        IRInst *inst = emit(op, size, dst, addr.base, b);
+        inst->var = addr.var;
+        inst->offset = addr.offset;
+        return inst;
+}
+
+// Loads a value of `type` from `addr`. Arrays, structs and unions are
+// not loaded; their value is their address.
+static int load(Address addr, Type *type) {
+        int dst = new_vreg();
+        if (is_aggregate(type))
+                emit_access(IR_ADDR, 8, dst, addr, 0);
+        else
+                emit_access(IR_LOAD, type->size, dst, addr, 0);
+        return dst;
+}
+
+enum { I8, I16, I32, I64 };
+
+static int type_id(Type *type) {
+        switch (type->kind) {
+                case TY_CHAR:
+                        return I8;
+                case TY_SHORT:
+                        return I16;
+                case TY_INT:
+                        return I32;
+        }
+        return I64;
+}
+
+// Converts `v` the way cast() in asmgen.c does
+static int cast(int v, Type *from, Type *to) {
+        if (to->kind == TY_VOID)
+                return v;
+        if (to->kind == TY_BOOL)
+                return compare_zero(IR_NE, is_integer(from) && from->size <= 4 ? 4 : 8, v);
+
+        int t1 = type_id(from);
+        int t2 = type_id(to);
+        int size = 0;
+        if (t2 == I8 && t1 > I8)
+                size = 1;
+        else if (t2 == I16 && t1 > I16)
+                size = 2;
+        else if (t2 == I64 && t1 < I64)
+                size = 4;
+        if (!size)
+                return v;
+
+        int dst = new_vreg();
+        emit(IR_SEXT, size, dst, v, 0);
+        return dst;
+}
+
+// Branches to `then` if `node` is true and to `els` otherwise, without
+// materializing the truth value of comparisons, ! and && or ||
+static void gen_cond(Node *node, IRBlock *then, IRBlock *els) {
+        if (node->node_type == ND_NOT) {
+                gen_cond(node->left, els, then);
+                return;
+        }
+
+        if (node->node_type == ND_LOGAND || node->node_type == ND_LOGOR) {
+                IRBlock *right = new_block();
+                if (node->node_type == ND_LOGAND)
+                        gen_cond(node->left, right, els);
+                else
+                        gen_cond(node->left, then, right);
+                start_block(right);
+                gen_cond(node->right, then, els);
+                return;
+        }
+
+        IRInst *br = emit(IR_BR, op_size(node->type), 0, gen_expr(node), 0);
+        br->then = then;
+        br->els = els;
+}
+
+static int gen_funcall(Node *node) {
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+                nargs++;
+
+        int *args = arena_alloc(&ir_arena, sizeof(int) * nargs);
+        int i = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+                args[i++] = gen_expr(arg);
+
+        int dst = new_vreg();
+        IRInst *inst = emit(IR_CALL, 8, dst, 0, 0);
+        inst->funcname = node->funcname;
+        inst->args = args;
+        inst->nargs = nargs;
+        return dst;
+}
+
+static void store_var(Obj *var, int v) {
+        emit_access(IR_STORE, var->type->size, 0, (Address){var}, v);
+}
+
+static int gen_assign(Node *node) {
+        // (a, b) = c assigns to b
+        Node *left = node->left;
+        while (left->node_type == ND_COMMA) {
+                gen_expr(left->left);
+                left = left->right;
+        }
+
+        Address addr = gen_address(left);
+        if (node->type->kind == TY_STRUCT || node->type->kind == TY_UNION) {
+                int src = gen_expr(node->right);
+                emit_access(IR_COPY, node->type->size, 0, addr, src);
+                return src;
+        }
+
+        int v = gen_expr(node->right);
+        emit_access(IR_STORE, node->type->size, 0, addr, v);
+        return v;
+}
+
+static IROp binary_ops[] = {
+        [ND_ADD] = IR_ADD, [ND_SUB] = IR_SUB, [ND_MUL] = IR_MUL,
+        [ND_DIV] = IR_DIV, [ND_MOD] = IR_MOD, [ND_BITAND] = IR_AND,
+        [ND_BITOR] = IR_OR, [ND_BITXOR] = IR_XOR, [ND_EQ] = IR_EQ,
+        [ND_NE] = IR_NE, [ND_LT] = IR_LT, [ND_LE] = IR_LE,
+};
+
+static int gen_expr(Node *node) {
+        current_file = node->token->file_no;
+        current_line = node->token->line_num;
+
+        switch (node->node_type) {
+                case ND_NUM:
+                        return gen_imm(node->val);
+                case ND_NEG:
+                case ND_BITNOT: {
+                                int dst = new_vreg();
+                                emit(node->node_type == ND_NEG ? IR_NEG : IR_BITNOT,
+                                                op_size(node->type), dst, gen_expr(node->left), 0);
+                                return dst;
+                        }
+                case ND_VAR:
+                case ND_MEMBER:
+                        return load(gen_address(node), node->type);
+                case ND_DEREF:
+                        if (is_aggregate(node->type))
+                                return gen_expr(node->left);
+                        return load(gen_address(node), node->type);
+                case ND_ADDRESS: {
+                                Address addr = gen_address(node->left);
+                                int dst = new_vreg();
+                                emit_access(IR_ADDR, 8, dst, addr, 0);
+                                return dst;
+                        }
+                case ND_ASSIGN:
+                        return gen_assign(node);
+                case ND_STATEMENT_EXPRESSION: {
+                                Node *n = node->body;
+                                for (; n && n->next; n = n->next)
+                                        gen_statement(n);
+                                if (n && n->node_type == ND_STATEMENT)
+                                        return gen_expr(n->left);
+                                if (n)
+                                        gen_statement(n);
+                                return gen_imm(0);
+                        }
+                case ND_COMMA:
+                        gen_expr(node->left);
+                        return gen_expr(node->right);
+                case ND_CAST:
+                        return cast(gen_expr(node->left), node->left->type, node->type);
+                case ND_NOT:
+                        return compare_zero(IR_EQ, op_size(node->left->type), gen_expr(node->left));
+                case ND_LOGAND:
+                case ND_LOGOR: {
+                                // The value goes through an unnamed local,
+                                // which to_ssa() turns into a phi
+                                Obj *var = arena_alloc(&ir_arena, sizeof(Obj));
+                                var->name = "";
+                                var->type = ty_int;
+                                var->is_local = true;
+                                IRBlock *then = new_block();
+                                IRBlock *els = new_block();
+                                IRBlock *end = new_block();
+                                gen_cond(node, then, els);
+                                start_block(then);
+                                store_var(var, gen_imm(1));
+                                jump(end);
+                                start_block(els);
+                                store_var(var, gen_imm(0));
+                                jump(end);
+                                start_block(end);
+                                return load((Address){var}, ty_int);
+                        }
+                case ND_FUNCALL:
+                        return gen_funcall(node);
+                case ND_ADD:
+                case ND_SUB:
+                case ND_MUL:
+                case ND_DIV:
+                case ND_MOD:
+                case ND_BITAND:
+                case ND_BITOR:
+                case ND_BITXOR:
+                case ND_EQ:
+                case ND_NE:
+                case ND_LT:
+                case ND_LE: {
+                                // The right operand is evaluated first
+                                int b = gen_expr(node->right);
+                                int a = gen_expr(node->left);
+                                int dst = new_vreg();
+                                emit(binary_ops[node->node_type], op_size(node->left->type), dst, a, b);
+                                return dst;
+                        }
+        }
+
+        error_tok(node->token, "invalid expression");
+}
+
+static void gen_statement(Node *node) {
+        current_file = node->token->file_no;
+        current_line = node->token->line_num;
+
+        switch (node->node_type) {
+                case ND_IF: {
+                                IRBlock *then = new_block();
+                                IRBlock *els = new_block();
+                                IRBlock *end = node->els ? new_block() : els;
+                                gen_cond(node->cond, then, els);
+                                start_block(then);
+                                gen_statement(node->then);
+                                jump(end);
+                                if (node->els) {
+                                        start_block(els);
+                                        gen_statement(node->els);
+                                        jump(end);
+                                }
+                                start_block(end);
+                                return;
+                        }
+                case ND_FOR: {
+                                // The condition is tested before the first
+                                // iteration and again at the end of every
+                                // iteration, so the loop has a single jump
+                                IRBlock *body = new_block();
+                                IRBlock *end = new_block();
+                                if (node->init)
+                                        gen_statement(node->init);
+                                if (node->cond)
+                                        gen_cond(node->cond, body, end);
+                                else
+                                        jump(body);
+                                start_block(body);
+                                gen_statement(node->then);
+                                if (node->inc)
+                                        gen_expr(node->inc);
+                                if (node->cond)
+                                        gen_cond(node->cond, body, end);
+                                else
+                                        jump(body);
+                                start_block(end);
+                                return;
+                        }
+                case ND_NULL_STATEMENT:
+                        return;
+                case ND_BLOCK:
+                        for (Node *n = node->body; n; n = n->next)
+                                gen_statement(n);
+                        return;
+                case ND_RETURN: {
+                                int v = gen_expr(node->left);
+                                emit(IR_RET, op_size(node->left->type), 0, v, 0);
+                                return;
+                        }
+                case ND_STATEMENT:
+                        gen_expr(node->left);
+                        return;
+        }
+
+        error_tok(node->token, "invalid statement");
+}
+
+// Marks the variables whose address is taken, which have to stay in
+// memory. `node` may be the first of a list of statements or arguments.
+// Only locals are ever promoted, so globals, which the threads of -j
+// share, are left alone.
+static void mark_address_taken(Node *node) {
+        for (; node; node = node->next) {
+                switch (node->node_type) {
+                        case ND_NUM:
+                        case ND_NULL_STATEMENT:
+                                break;
+                        case ND_VAR:
+                                // An array decays to a pointer to its storage
+                                if (node->var->is_local && node->var->type->kind == TY_ARRAY)
+                                        node->var->is_address_taken = true;
+                                break;
+                        case ND_ADDRESS: {
+                                        Node *n = node->left;
+                                        while (n->node_type == ND_COMMA)
+                                                n = n->right;
+                                        if (n->node_type == ND_VAR && n->var->is_local)
+                                                n->var->is_address_taken = true;
+                                        mark_address_taken(node->left);
+                                        break;
+                                }
+                        case ND_IF:
+                        case ND_FOR:
+                                mark_address_taken(node->cond);
+                                mark_address_taken(node->then);
+                                mark_address_taken(node->els);
+                                mark_address_taken(node->inc);
+                                break;
+                        case ND_BLOCK:
+                        case ND_STATEMENT_EXPRESSION:
+                                mark_address_taken(node->body);
+                                break;
+                        case ND_FUNCALL:
+                                mark_address_taken(node->args);
+                                break;
+                        case ND_MEMBER:
+                                mark_address_taken(node->left);
+                                break;
+                        default:
+                                // Operators, ND_RETURN, ND_STATEMENT and ND_CAST
+                                mark_address_taken(node->left);
+                                mark_address_taken(node->right);
+                }
+        }
+}
+
+// Returns the virtual registers `inst` reads, apart from the arguments
+// of IR_PHI
+int ir_uses(IRInst *inst, int *uses) {
+        int n = 0;
+        if (inst->op == IR_CALL)
+                for (int i = 0; i < inst->nargs; i++)
+                        uses[n++] = inst->args[i];
+        if (inst->a)
+                uses[n++] = inst->a;
+        if (inst->b)
+                uses[n++] = inst->b;
+        return n;
+}
+
+// Returns the virtual registers `inst` writes
+int ir_defs(IRInst *inst, int *defs) {
+        int n = 0;
+        if (inst->op == IR_PARAMS) {
+                for (int i = 0; i < inst->nargs; i++)
+                        defs[n++] = inst->args[i];
+        } else if (inst->dst) {
+                defs[n++] = inst->dst;
+        }
+        return n;
+}
+
+int ir_successors(IRBlock *block, IRBlock **succ) {
+        IRInst *last = block->last;
+        switch (last ? last->op : IR_IMM) {
+                case IR_JMP:
+                        succ[0] = last->then;
+                        return 1;
+                case IR_BR:
+                        succ[0] = last->then;
+                        succ[1] = last->els;
+                        return 2;
+                case IR_RET:
+                        return 0;
+        }
+        succ[0] = block->next;
+        return block->next ? 1 : 0;
+}
+
+bool ir_has_side_effects(IRInst *inst) {
+        switch (inst->op) {
+                case IR_STORE:
+                case IR_COPY:
+                case IR_CALL:
+                case IR_PARAMS:
+                case IR_JMP:
+                case IR_BR:
+                case IR_RET:
+                        return true;
+        }
+        return false;
+}
+
+// Returns the code of `func` in SSA form
+IRFunc *gen_ir(Obj *func) {
+        ir_func = arena_alloc(&ir_arena, sizeof(IRFunc));
+        ir_func->func = func;
+        last_block = NULL;
+        start_block(new_block());
+        current_file = func->body->token->file_no;
+        current_line = func->body->token->line_num;
+        mark_address_taken(func->body);
+
+        // The parameters arrive in virtual registers and are stored to
+        // their variables like any other value
+        int nparams = 0;
+        for (Obj *var = func->params; var; var = var->next)
+                nparams++;
+        IRInst *params = emit(IR_PARAMS, 0, 0, 0, 0);
+        params->args = arena_alloc(&ir_arena, sizeof(int) * nparams);
+        params->nargs = nparams;
+        for (int i = 0; i < nparams; i++)
+                params->args[i] = new_vreg();
+        int i = 0;
+        for (Obj *var = func->params; var; var = var->next)
+                store_var(var, params->args[i++]);
+
+        gen_statement(func->body);
+        emit(IR_RET, 0, 0, 0, 0);
+        to_ssa(ir_func);
+        optimize_ir(ir_func);
+        return ir_func;
+}
+
+static char *ir_names[] = {
+        [IR_IMM] = "imm", [IR_MOV] = "mov", [IR_ADD] = "add", [IR_SUB] = "sub",
+        [IR_MUL] = "mul", [IR_DIV] = "div", [IR_MOD] = "mod", [IR_AND] = "and",
+        [IR_OR] = "or", [IR_XOR] = "xor", [IR_EQ] = "eq", [IR_NE] = "ne",
+        [IR_LT] = "lt", [IR_LE] = "le", [IR_NEG] = "neg", [IR_BITNOT] = "not",
+        [IR_SEXT] = "sext", [IR_ADDR] = "addr", [IR_LOAD] = "load",
+        [IR_STORE] = "store", [IR_COPY] = "copy", [IR_CALL] = "call",
+        [IR_PARAMS] = "params", [IR_JMP] = "jmp", [IR_BR] = "br", [IR_RET] = "ret",
+        [IR_PHI] = "phi",
+};
+
+static void print_address(IRInst *inst, FILE *out) {
+        if (!inst->var)
+                fprintf(out, "[%%%d", inst->a);
+        else if (!inst->var->is_local)
+                fprintf(out, "[@%s", inst->var->name);
+        else
+                fprintf(out, "[%s", *inst->var->name ? inst->var->name : ".tmp");
+        if (inst->offset)
+                fprintf(out, "%+d", inst->offset);
+        fprintf(out, "]");
+}
+
+static void print_inst(IRBlock *block, IRInst *inst, FILE *out) {
+        fprintf(out, "  ");
+        if (inst->op == IR_PARAMS) {
+                for (int i = 0; i < inst->nargs; i++)
+                        fprintf(out, "%s%%%d", i ? ", " : "", inst->args[i]);
+                fprintf(out, inst->nargs ? " = params\n" : "params\n");
+                return;
+        }
+
+        if (inst->dst)
+                fprintf(out, "%%%d = ", inst->dst);
+        fprintf(out, "%s", ir_names[inst->op]);
+        if (inst->size && inst->op != IR_IMM && inst->op != IR_MOV && inst->op != IR_ADDR &&
+                        inst->op != IR_CALL && inst->op != IR_PHI)
+                fprintf(out, ".%d", inst->size);
+
+        switch (inst->op) {
+                case IR_IMM:
+                        fprintf(out, " %ld", inst->imm);
+                        break;
+                case IR_ADDR:
+                case IR_LOAD:
+                        fprintf(out, " ");
+                        print_address(inst, out);
+                        break;
+                case IR_STORE:
+                case IR_COPY:
+                        fprintf(out, " ");
+                        print_address(inst, out);
+                        if (inst->b)
+                                fprintf(out, ", %%%d", inst->b);
+                        else
+                                fprintf(out, ", %ld", inst->imm);
+                        break;
+                case IR_CALL:
+                        fprintf(out, " %s(", inst->funcname);
+                        for (int i = 0; i < inst->nargs; i++)
+                                fprintf(out, "%s%%%d", i ? ", " : "", inst->args[i]);
+                        fprintf(out, ")");
+                        break;
+                case IR_PHI:
+                        for (int i = 0; i < inst->nargs; i++)
+                                fprintf(out, "%s [%%%d, bb%d]", i ? "," : "", inst->args[i], block->preds[i]->id);
+                        break;
+                case IR_JMP:
+                        fprintf(out, " bb%d", inst->then->id);
+                        break;
+                case IR_BR:
+                        fprintf(out, " %%%d, bb%d, bb%d", inst->a, inst->then->id, inst->els->id);
+                        break;
+                case IR_RET:
+                        if (inst->a)
+                                fprintf(out, " %%%d", inst->a);
+                        break;
+                default:
+                        fprintf(out, " %%%d", inst->a);
+                        if (inst->b)
+                                fprintf(out, ", %%%d", inst->b);
+                        else if (inst->op >= IR_ADD && inst->op <= IR_LE)
+                                fprintf(out, ", %ld", inst->imm);
+        }
+        fprintf(out, "\n");
+}
+
+void print_ir(IRFunc *func, FILE *out) {
+        fprintf(out, "%s:\n", func->func->name);
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                fprintf(out, "bb%d:", block->id);
+                for (int i = 0; i < block->npreds; i++)
+                        fprintf(out, "%s bb%d", i ? "," : " ; preds", block->preds[i]->id);
+                fprintf(out, "\n");
+                for (IRInst *inst = block->insts; inst; inst = inst->next)
+                        print_inst(block, inst, out);
+        }
+}
+
+// Writes the IR of every function in `program` for --emit=ir
+void emit_ir(Obj *program, FILE *out) {
+        for (Obj *func = program; func; func = func->next) {
+                if (!func->is_function || !func->is_definition)
+                        continue;
+                print_ir(gen_ir(func), out);
+                arena_release(&ir_arena);
+        }
+}
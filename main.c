@@ -1,20 +1,58 @@
 #include "token.h"
 
-void free_memory(Token *token, Obj *program) {
-        free_token(token);
-        if (program == NULL)
-                return;
-        free(program->next);
-        free_lvar(program->locals);
-        free_node(program->body);
-}
-
 static char *opt_o;
 
-static char *input_path;
+static bool opt_mem_stats;
+
+static bool opt_time_report;
+
+static bool opt_E;
+
+static bool opt_emit_pch;
+
+static char *opt_include_pch;
+
+static bool opt_pipeline;
+
+static bool opt_stream;
+
+static bool opt_lazy_bodies;
+
+static int opt_jobs = 1;
+
+static int opt_O;
+
+static bool opt_emit_ir;
+
+static bool opt_c;
+
+static bool opt_run;
+
+// --run: arguments after -- for the program, and its assembly
+static char **run_args;
+static int run_arg_count;
+static Output *run_output;
+
+static int opt_peephole = -1; // On at -O1 and above unless given
+
+static bool opt_peephole_stats;
+
+static char **input_paths;
+static int input_count;
+
+// Phase times of one translation unit in milliseconds
+typedef struct {
+        double load_pch;
+        double tokenize;
+        double preprocess;
+        double parse;
+        double codegen;
+} Timing;
+
+static Timing *timings;
 
 static void usage(int status) {
-        fprintf(stderr, "main [ -o <path> ] <file>\n");
+        fprintf(stderr, "main [ -o <path> ] [ -E ] [ -c ] [ --run [ --load <lib> ] ] [ -I <dir> ] [ --emit-pch ] [ --include-pch <file> ] [ --mem-stats ] [ --time-report ] [ -j <n> ] [ --pipeline ] [ --stream ] [ --lazy-bodies ] [ -O<level> ] [ --emit=asm|ir ] [ --peephole | --no-peephole ] [ --peephole-stats ] <file>... [ -- <program args> ]\n");
         exit(status);
 }
 
@@ -23,6 +61,121 @@ static void parse_args(int argc, char **argv) {
                 if (!strcmp(argv[i], "--help"))
                         usage(0);
 
+                if (!strcmp(argv[i], "--mem-stats")) {
+                        opt_mem_stats = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--time-report")) {
+                        opt_time_report = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--lazy-bodies")) {
+                        opt_lazy_bodies = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--stream")) {
+                        opt_stream = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--pipeline")) {
+                        opt_pipeline = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "-E")) {
+                        opt_E = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "-I")) {
+                        if (!argv[++i])
+                                usage(1);
+                        add_include_path(argv[i]);
+                        continue;
+                }
+
+                if (!strncmp(argv[i], "-I", 2)) {
+                        add_include_path(argv[i] + 2);
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--emit-pch")) {
+                        opt_emit_pch = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--include-pch")) {
+                        if (!argv[++i])
+                                usage(1);
+                        opt_include_pch = argv[i];
+                        continue;
+                }
+
+                if (!strncmp(argv[i], "-j", 2)) {
+                        char *n = argv[i][2] ? argv[i] + 2 : argv[++i];
+                        if (!n)
+                                usage(1);
+                        opt_jobs = atoi(n);
+                        if (opt_jobs < 1)
+                                error("invalid number of jobs: %s", n);
+                        continue;
+                }
+
+                if (!strncmp(argv[i], "-O", 2)) {
+                        char *level = argv[i] + 2;
+                        if (!*level)
+                                level = "1";
+                        if (!isdigit(*level) || level[1])
+                                error("invalid optimization level: %s", argv[i]);
+                        opt_O = *level - '0';
+                        continue;
+                }
+
+                if (!strncmp(argv[i], "--emit=", 7)) {
+                        char *kind = argv[i] + 7;
+                        if (strcmp(kind, "asm") && strcmp(kind, "ir"))
+                                error("unknown output kind: %s", argv[i]);
+                        opt_emit_ir = !strcmp(kind, "ir");
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--peephole") || !strcmp(argv[i], "--no-peephole")) {
+                        opt_peephole = !strcmp(argv[i], "--peephole");
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--peephole-stats")) {
+                        opt_peephole_stats = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--run")) {
+                        opt_run = true;
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--load")) {
+                        if (!argv[++i])
+                                usage(1);
+                        load_library(argv[i]);
+                        continue;
+                }
+
+                if (!strcmp(argv[i], "--")) {
+                        run_args = argv + i + 1;
+                        run_arg_count = argc - i - 1;
+                        break;
+                }
+
+                if (!strcmp(argv[i], "-c")) {
+                        opt_c = true;
+                        continue;
+                }
+
                 if (!strcmp(argv[i], "-o")) {
                         if (!argv[++i])
                                 usage(1);
@@ -38,11 +191,20 @@ static void parse_args(int argc, char **argv) {
                 if (argv[i][0] == '-' && argv[i][1] != '\0')
                         error("unknown argument: %s", argv[i]);
 
-                input_path = argv[i];
+                input_paths = realloc(input_paths, sizeof(char *) * (input_count + 1));
+                input_paths[input_count++] = argv[i];
         }
 
-        if (!input_path)
+        if (!input_count)
                 error("no input files");
+        if (input_count > 1 && (opt_o || opt_E || opt_emit_pch))
+                error("-o, -E and --emit-pch take a single input file");
+        if (opt_emit_pch && !opt_o)
+                error("--emit-pch needs an output file");
+        if (opt_c && opt_emit_ir)
+                error("-c and --emit=ir can not be used together");
+        if (opt_run && (input_count > 1 || opt_c || opt_E || opt_emit_pch || opt_emit_ir))
+                error("--run takes a single input file and no other output option");
 }
 
 static FILE *open_file(char *path) {
@@ -55,16 +217,246 @@ static FILE *open_file(char *path) {
         return out;
 }
 
+static void close_file(FILE *out) {
+        if (out == stdout ? fflush(out) : fclose(out))
+                error("cannot write output file: %s", strerror(errno));
+}
+
+// With several inputs, every foo.c is compiled to foo.s, to foo.ir with
+// --emit=ir or to foo.o with -c. So is a single input with -c and no -o.
+static char *assembly_path(char *path) {
+        int len = strlen(path);
+        if (len > 2 && !strcmp(path + len - 2, ".c"))
+                len -= 2;
+        return format("%.*s.%s", len, path, opt_emit_ir ? "ir" : opt_c ? "o" : "s");
+}
+
+// With -c the assembly is kept in memory and assembled into `path` when
+// it is complete; with --run it is kept for main() to run
+static Output *open_output(char *path) {
+        return opt_c || opt_run ? out_memory() : out_open(path);
+}
+
+static void close_output(Output *out, char *path) {
+        if (opt_run) {
+                run_output = out;
+                return;
+        }
+        if (opt_c)
+                assemble(out->buf, out->len, path);
+        out_close(out);
+}
+
+// Returns the current time in milliseconds
+static double now(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+// Frees the AST, locals and block scopes of a function that has been
+// written out
+static void release_function(Obj *func, Arena *ast) {
+        func->body = NULL;
+        func->params = func->locals = NULL;
+        arena_release(ast);
+}
+
+// --stream writes every function as soon as it is parsed and frees its
+// AST before the next one is read, so memory use is bounded by the
+// largest function instead of by the whole file
+static _Thread_local Output *stream_out;
+
+static void emit_function(Obj *func) {
+        gen_function_text(func, stream_out);
+        release_function(func, &node_arena);
+}
+
+// --pipeline runs the parser and the code generator at the same time.
+// The parser hands every function definition over to a codegen thread
+// as soon as it is complete, along with the region its AST was
+// allocated from; global variables are written at the end.
+typedef struct {
+        Obj *func;
+        Arena ast;
+} ParsedFunction;
+
+typedef struct {
+        Queue functions; // ParsedFunctions, ending with NULL
+        Token *tokens;
+        Output *out;
+        File **files;
+        Obj *program;
+        double parsed;
+} Pipeline;
+
+static _Thread_local Pipeline *pipeline;
+
+static void hand_off(Obj *func) {
+        ParsedFunction *parsed = malloc(sizeof(ParsedFunction));
+        *parsed = (ParsedFunction){func, arena_detach(&node_arena)};
+        queue_push(&pipeline->functions, parsed);
+}
+
+static void parse_stage(void *arg) {
+        pipeline = arg;
+        pipeline->program = parse(pipeline->tokens, hand_off, opt_lazy_bodies);
+        pipeline->parsed = now();
+        queue_push(&pipeline->functions, NULL);
+}
+
+static void *codegen_stage(void *arg) {
+        Pipeline *p = arg;
+        set_input_files(p->files);
+        for (ParsedFunction *parsed; (parsed = queue_pop(&p->functions));) {
+                gen_function_text(parsed->func, p->out);
+                release_function(parsed->func, &parsed->ast);
+                free(parsed);
+        }
+        return NULL;
+}
+
+// Drops everything the last translation unit left behind, so that the
+// thread can compile the next one
+static void end_compilation(void) {
+        reset_codegen();
+        reset_parser();
+        reset_preprocessor();
+        reset_tokenizer();
+        reset_types();
+        release_all_arenas();
+}
+
+// Numbers every file of the unit for the .loc directives of the code
+static void write_file_directives(Output *out) {
+        File **files = get_input_files();
+        for (int i = 1; files[i]; i++)
+                out_format(out, ".file %d \"%s\"\n", i, files[i]->name);
+}
+
+// Compiles one input file. With several inputs this runs on the worker
+// threads, so it must only use thread-local compiler state.
+static void compile(int job) {
+        char *input_path = input_paths[job];
+        char *output_path = input_count > 1 || (opt_c && !opt_o) ? assembly_path(input_path) : opt_o;
+
+        // Tokenize, preprocess and parse
+        double start = now();
+        if (opt_include_pch)
+                load_pch(opt_include_pch);
+        double loaded = now();
+        Token *token = tokenize_file(input_path);
+        if (!token)
+                error("cannot open %s: %s", input_path, strerror(errno));
+        double lexed = now();
+        token = preprocess(token);
+        double preprocessed = now();
+
+        if (opt_E) {
+                FILE *out = open_file(output_path);
+                print_tokens(token, out);
+                close_file(out);
+        } else if (opt_emit_pch) {
+                parse(token, NULL, false);
+                write_pch(output_path);
+        } else if (opt_emit_ir) {
+                Obj *program = parse(token, NULL, opt_lazy_bodies);
+                double parsed = now();
+
+                FILE *out = open_file(output_path);
+                emit_ir(program, out);
+                close_file(out);
+                double generated = now();
+
+                timings[job] = (Timing){loaded - start, lexed - loaded, preprocessed - lexed,
+                        parsed - preprocessed, generated - parsed};
+        } else if (opt_stream) {
+                stream_out = open_output(output_path);
+                write_file_directives(stream_out);
+                Obj *program = parse(token, emit_function, opt_lazy_bodies);
+                double parsed = now();
+                gen_data(program, stream_out);
+                close_output(stream_out, output_path);
+                double generated = now();
+
+                timings[job] = (Timing){loaded - start, lexed - loaded, preprocessed - lexed,
+                        parsed - preprocessed, generated - parsed};
+        } else if (opt_pipeline) {
+                Pipeline p = {.tokens = token, .files = get_input_files()};
+                p.out = open_output(output_path);
+                write_file_directives(p.out);
+                run_pipeline(parse_stage, codegen_stage, &p);
+                gen_data(p.program, p.out);
+                close_output(p.out, output_path);
+                double generated = now();
+
+                timings[job] = (Timing){loaded - start, lexed - loaded, preprocessed - lexed,
+                        p.parsed - preprocessed, generated - p.parsed};
+        } else {
+                Obj *program = parse(token, NULL, opt_lazy_bodies);
+                double parsed = now();
+
+                Output *out = open_output(output_path);
+                write_file_directives(out);
+                gen_asm(program, out, input_count == 1 ? opt_jobs : 1);
+                close_output(out, output_path);
+                double generated = now();
+
+                timings[job] = (Timing){loaded - start, lexed - loaded, preprocessed - lexed,
+                        parsed - preprocessed, generated - parsed};
+        }
+
+        if (opt_mem_stats) {
+                flockfile(stderr);
+                if (input_count > 1)
+                        fprintf(stderr, "%s:\n", input_path);
+                print_mem_stats(stderr);
+                print_type_stats(stderr);
+                funlockfile(stderr);
+        }
+        end_compilation();
+}
+
 int main(int argc, char **argv) {
         parse_args(argc, argv);
+        // --emit=ir shows the code -O1 compiles
+        set_parser_optimization(opt_emit_ir ? 1 : opt_O);
+        set_optimization(opt_O);
+        set_peephole(opt_peephole < 0 ? opt_O >= 1 : opt_peephole);
 
-        // Tokenize and parse
-        Token *token = tokenize_file(input_path);
-        Obj *program = parse(token);
+        timings = calloc(input_count, sizeof(Timing));
+        double start = now();
+        run_jobs(input_count, opt_jobs, compile);
+        double end = now();
 
-        FILE* out = open_file(opt_o);
-        fprintf(out, ".file 1 \"%s\"\n", input_path);
-        gen_asm(program, out);
-        free_memory(token, program);
+        // Phase times are summed over all inputs, the total is wall time
+        if (opt_time_report && !opt_E && !opt_emit_pch) {
+                Timing sum = {};
+                for (int i = 0; i < input_count; i++) {
+                        sum.load_pch += timings[i].load_pch;
+                        sum.tokenize += timings[i].tokenize;
+                        sum.preprocess += timings[i].preprocess;
+                        sum.parse += timings[i].parse;
+                        sum.codegen += timings[i].codegen;
+                }
+                if (opt_include_pch)
+                        fprintf(stderr, "load-pch %10.3f ms\n", sum.load_pch);
+                fprintf(stderr, "tokenize %10.3f ms\n", sum.tokenize);
+                fprintf(stderr, "preprocess %8.3f ms\n", sum.preprocess);
+                fprintf(stderr, "parse    %10.3f ms\n", sum.parse);
+                fprintf(stderr, "codegen  %10.3f ms\n", sum.codegen);
+                fprintf(stderr, "total    %10.3f ms\n", end - start);
+        }
+        if (opt_peephole_stats)
+                print_peephole_stats(stderr);
+
+        if (opt_run) {
+                // The program sees its source file as argv[0]
+                char **args = calloc(run_arg_count + 2, sizeof(char *));
+                args[0] = input_paths[0];
+                for (int i = 0; i < run_arg_count; i++)
+                        args[i + 1] = run_args[i];
+                return run_assembly(run_output->buf, run_output->len, run_arg_count + 1, args);
+        }
         return 0;
 }
@@ -0,0 +1,189 @@
+#include "token.h"
+
+// Buffered output of generated assembly. Text is formatted straight into
+// a buffer, without going through stdio, and written to the file
+// descriptor with write(2) once OUTPUT_CHUNK bytes have piled up. An
+// Output with fd -1 keeps everything in memory.
+
+#define OUTPUT_CHUNK (1 << 16)
+
+// Buffers per writev(2) call, IOV_MAX on Linux
+#define IOV_BATCH 1024
+
+// Opens `path` for writing, or stdout if it is NULL or "-"
+Output *out_open(char *path) {
+        Output *out = calloc(1, sizeof(Output));
+        out->fd = STDOUT_FILENO;
+        if (path && strcmp(path, "-")) {
+                out->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+                if (out->fd < 0)
+                        error("cannot open output file: %s: %s", path, strerror(errno));
+        }
+        return out;
+}
+
+// Returns an Output that keeps the text in memory
+Output *out_memory(void) {
+        Output *out = calloc(1, sizeof(Output));
+        out->fd = -1;
+        return out;
+}
+
+static void write_all(int fd, char *buf, size_t len) {
+        while (len) {
+                ssize_t n = write(fd, buf, len);
+                if (n < 0 && errno == EINTR)
+                        continue;
+                if (n < 0)
+                        error("cannot write output file: %s", strerror(errno));
+                buf += n;
+                len -= n;
+        }
+}
+
+void out_flush(Output *out) {
+        if (out->fd < 0)
+                return;
+        write_all(out->fd, out->buf, out->len);
+        out->len = 0;
+}
+
+// Flushes `out`, closes its file unless it is stdout and frees it
+void out_close(Output *out) {
+        out_flush(out);
+        if (out->fd >= 0 && out->fd != STDOUT_FILENO && close(out->fd))
+                error("cannot write output file: %s", strerror(errno));
+        free(out->buf);
+        free(out);
+}
+
+// Makes room for `len` more bytes
+static void reserve(Output *out, size_t len) {
+        if (out->len + len <= out->cap)
+                return;
+        if (out->fd >= 0 && out->len >= OUTPUT_CHUNK)
+                out_flush(out);
+        if (out->len + len <= out->cap)
+                return;
+
+        size_t cap = out->cap ? out->cap : 4096;
+        while (cap < out->len + len)
+                cap *= 2;
+        out->buf = realloc(out->buf, cap);
+        out->cap = cap;
+}
+
+void out_write(Output *out, char *s, size_t len) {
+        reserve(out, len);
+        memcpy(out->buf + out->len, s, len);
+        out->len += len;
+}
+
+void out_putc(Output *out, char c) {
+        reserve(out, 1);
+        out->buf[out->len++] = c;
+}
+
+static void out_long(Output *out, long val) {
+        char digits[24];
+        char *p = digits + sizeof(digits);
+        unsigned long u = val < 0 ? -(unsigned long)val : val;
+        do {
+                *--p = '0' + u % 10;
+                u /= 10;
+        } while (u);
+        if (val < 0)
+                *--p = '-';
+        out_write(out, p, digits + sizeof(digits) - p);
+}
+
+// Appends `fmt` formatted with the arguments in `ap`. Only the
+// conversions the code generator needs are supported: %d, %ld, %s, %c
+// and %%.
+void out_vformat(Output *out, char *fmt, va_list ap) {
+        for (char *p = fmt;;) {
+                char *start = p;
+                while (*p && *p != '%')
+                        p++;
+                if (p != start)
+                        out_write(out, start, p - start);
+                if (!*p)
+                        return;
+
+                switch (p[1]) {
+                        case 'd':
+                                out_long(out, va_arg(ap, int));
+                                p += 2;
+                                break;
+                        case 'l':
+                                if (p[2] != 'd')
+                                        unreachable();
+                                out_long(out, va_arg(ap, long));
+                                p += 3;
+                                break;
+                        case 's': {
+                                        char *s = va_arg(ap, char *);
+                                        out_write(out, s, strlen(s));
+                                        p += 2;
+                                        break;
+                                }
+                        case 'c':
+                                out_putc(out, va_arg(ap, int));
+                                p += 2;
+                                break;
+                        case '%':
+                                out_putc(out, '%');
+                                p += 2;
+                                break;
+                        default:
+                                unreachable();
+                }
+        }
+}
+
+void out_format(Output *out, char *fmt, ...) {
+        va_list ap;
+        va_start(ap, fmt);
+        out_vformat(out, fmt, ap);
+        va_end(ap);
+}
+
+// Appends the text of the in-memory outputs `parts` to `out`. A file
+// gets them with as few writev(2) calls as possible, without copying.
+void out_append(Output *out, Output *parts, int count) {
+        if (out->fd < 0) {
+                for (int i = 0; i < count; i++)
+                        out_write(out, parts[i].buf, parts[i].len);
+                return;
+        }
+
+        out_flush(out);
+        struct iovec iov[IOV_BATCH];
+        for (int i = 0; i < count;) {
+                int n = 0;
+                size_t total = 0;
+                for (; i < count && n < IOV_BATCH; i++) {
+                        if (!parts[i].len)
+                                continue;
+                        iov[n++] = (struct iovec){parts[i].buf, parts[i].len};
+                        total += parts[i].len;
+                }
+
+                // Retry what a short write left over
+                struct iovec *next = iov;
+                while (total) {
+                        ssize_t written = writev(out->fd, next, n - (next - iov));
+                        if (written < 0 && errno == EINTR)
+                                continue;
+                        if (written < 0)
+                                error("cannot write output file: %s", strerror(errno));
+                        total -= written;
+                        while (written && written >= (ssize_t)next->iov_len)
+                                written -= (next++)->iov_len;
+                        if (written) {
+                                next->iov_base = (char *)next->iov_base + written;
+                                next->iov_len -= written;
+                        }
+                }
+        }
+}
@@ -1,12 +1,41 @@
 // This file is a recursive descent parser for C
 #include "token.h"
 
+// Symbols are kept in two scoped hash tables, one per namespace. C has
+// two block scopes; one is for variables/typedefs and the other is for
+// struct/union/enum tags. A declaration is pushed in front of its hash
+// chain, so it shadows declarations of the same name in outer blocks,
+// and is appended to the table's undo log. Leaving a block pops the
+// log entries made at that depth, so entering and leaving a block is
+// O(1) per declaration and lookups never walk other names.
+typedef struct ScopeEntry ScopeEntry;
+struct ScopeEntry {
+        ScopeEntry *next; // Next entry in the same hash chain
+        char *name; // Interned, compared by address
+        int depth; // Block depth of the declaration, 0 for file scope
+        int index; // Position in the undo log
+};
+
+typedef struct {
+        ScopeEntry **buckets;
+        int capacity;
+        int count;
+
+        // Undo log of live entries in declaration order
+        ScopeEntry **log;
+        int log_capacity;
+
+        // While a deferred body is parsed, file-scope entries from log
+        // index `limit` on are declared after it and cannot be seen
+        bool is_limited;
+        int limit;
+} SymbolTable;
+
 // Scope for local variables, global variables, typedefs
 // or enum constants
 typedef struct var_scope var_scope;
 struct var_scope {
-        var_scope *next;
-        char *name;
+        ScopeEntry entry;
         Obj *var;
         Type *type_def;
         Type *enum_type;
@@ -16,60 +45,83 @@ struct var_scope {
 // Scope for struct, union, or enum tags
 typedef struct tag_scope tag_scope;
 struct tag_scope {
-        tag_scope *next;
-        char *name;
+        ScopeEntry entry;
         Type *type;
 };
 
-// Block scope
-typedef struct Scope Scope;
-struct Scope {
-        Scope *next;
-
-        // C has two block scopes; one is for variables/typedefs and
-        // the other is for struct/union/enum tags
-        var_scope *vars;
-        tag_scope *tags;
-};
-
 typedef struct {
         bool is_typedef;
         bool is_static;
 } var_attribute;
 
+// Binding strength of binary operators, loosest first
+enum {
+        PREC_LOGOR = 1,
+        PREC_LOGAND,
+        PREC_BITOR,
+        PREC_BITXOR,
+        PREC_BITAND,
+        PREC_EQUALITY,
+        PREC_RELATIONAL,
+        PREC_ADD,
+        PREC_MUL,
+};
+
+// -O level; set before any thread starts
+static int opt_level;
+
+// Parser state is per thread, see reset_parser()
+
 // Local variables in the parser
-static Obj *locals;
+static _Thread_local Obj *locals;
 
 // Global variables in this list
-static Obj *globals;
+static _Thread_local Obj *globals;
 
-static Scope *scope = &(Scope){};
+static _Thread_local SymbolTable var_table;
+static _Thread_local SymbolTable tag_table;
+
+// Current block depth
+static _Thread_local int scope_depth;
 
 // Points to the function object the parser is currently parsing
-static Obj *current_func;
+static _Thread_local Obj *current_func;
+
+// Numbers the anonymous globals of string literals
+static _Thread_local int unique_name_count;
+
+// Called with every function definition once it is parsed
+static _Thread_local void (*function_done)(Obj *func);
+
+// With lazy parsing, the top-level pass only parses declarations and
+// remembers where the function bodies are, along with how much of the
+// file scope had been declared there
+typedef struct {
+        Obj *func;
+        int var_count;
+        int tag_count;
+} DeferredBody;
+
+static _Thread_local bool lazy_bodies;
+static _Thread_local DeferredBody *deferred;
+static _Thread_local int deferred_count;
+static _Thread_local int deferred_capacity;
 
 static bool is_typename(Token *token);
 static Type *declaration_specifier(Token **rest, Token *token, var_attribute *attribute);
 static Type *enum_specifier(Token **rest, Token *token);
 static Type *type_suffix(Token **rest, Token *token, Type *type);
-static Type *declarator(Token **rest, Token *token, Type *type);
+static Type *declarator(Token **rest, Token *token, Type *type, Token **name);
 static Node *declaration(Token **rest, Token *token, Type *basetype);
 static Node *compound_statement(Token **rest, Token *token);
 static Node *statement(Token **rest, Token *token);
 static Node *expr_statement(Token **rest, Token *token);
 static Node *expr(Token **rest, Token *token);
 static Node *assign(Token **rest, Token *token);
-static Node *logor(Token **rest, Token *token);
-static Node *logand(Token **rest, Token *token);
-static Node *bitor(Token **rest, Token *token);
-static Node *bitxor(Token **rest, Token *token);
-static Node *bitand(Token **rest, Token *token);
-static Node *equality(Token **rest, Token *token);
-static Node *relational(Token **rest, Token *token);
-static Node *add(Token **rest, Token *token);
+static Node *binary(Token **rest, Token *token, int min_prec);
+static int64_t const_expr(Token **rest, Token *token);
 static Node *new_add(Node *left, Node *right, Token *token);
 static Node *new_sub(Node *left, Node *right, Token *token);
-static Node *mul(Token **rest, Token *token);
 static Node *cast(Token **rest, Token *token);
 static Type *struct_declaration(Token **rest, Token *token);
 static Type *union_declaration(Token **rest, Token *token);
@@ -78,66 +130,118 @@ static Node *unary(Token **rest, Token *token);
 static Node *primary(Token **rest, Token *token);
 static Token *parse_typedef(Token *token, Type *basetype);
 
-// TODO: free scopes
+static int bucket_of(SymbolTable *table, char *name) {
+        // Atoms are 16-byte aligned arena allocations
+        return ((uintptr_t)name >> 4) & (table->capacity - 1);
+}
+
+static void grow_table(SymbolTable *table) {
+        ScopeEntry **old = table->buckets;
+        int old_capacity = table->capacity;
+
+        table->capacity = old_capacity ? old_capacity * 2 : 256;
+        table->buckets = calloc(table->capacity, sizeof(ScopeEntry *));
+        if (table->buckets == NULL)
+                error("not enough memory in system to allocate symbol table");
+
+        // Append to the new chains in old chain order so inner
+        // declarations stay in front of the ones they shadow
+        ScopeEntry **tails = calloc(table->capacity, sizeof(ScopeEntry *));
+        for (int i = 0; i < old_capacity; i++) {
+                for (ScopeEntry *e = old[i], *next; e; e = next) {
+                        next = e->next;
+                        int b = bucket_of(table, e->name);
+                        e->next = NULL;
+                        if (tails[b])
+                                tails[b]->next = e;
+                        else
+                                table->buckets[b] = e;
+                        tails[b] = e;
+                }
+        }
+        free(tails);
+        free(old);
+}
+
+static void table_push(SymbolTable *table, ScopeEntry *e, char *name) {
+        if (table->count * 2 >= table->capacity)
+                grow_table(table);
+
+        if (table->count == table->log_capacity) {
+                table->log_capacity = table->log_capacity ? table->log_capacity * 2 : 256;
+                table->log = realloc(table->log, sizeof(ScopeEntry *) * table->log_capacity);
+                if (table->log == NULL)
+                        error("not enough memory in system to allocate symbol table");
+        }
+
+        e->name = name;
+        e->depth = scope_depth;
+        e->index = table->count;
+        int b = bucket_of(table, name);
+        e->next = table->buckets[b];
+        table->buckets[b] = e;
+        table->log[table->count++] = e;
+}
+
+static ScopeEntry *table_find(SymbolTable *table, char *name) {
+        if (!name || !table->capacity)
+                return NULL;
+        for (ScopeEntry *e = table->buckets[bucket_of(table, name)]; e; e = e->next)
+                if (e->name == name && !(table->is_limited && e->depth == 0 && e->index >= table->limit))
+                        return e;
+        return NULL;
+}
+
+// Pops the entries declared in the current block
+static void table_pop(SymbolTable *table) {
+        while (table->count && table->log[table->count - 1]->depth == scope_depth) {
+                ScopeEntry *e = table->log[--table->count];
+                ScopeEntry **p = &table->buckets[bucket_of(table, e->name)];
+                while (*p != e)
+                        p = &(*p)->next;
+                *p = e->next;
+        }
+}
+
 static void enter_scope(void) {
-        Scope *sc = calloc(1, sizeof(Scope));
-        if (sc == NULL)
-                error("not enough memory in system to allocate scope");
-        sc->next = scope;
-        scope = sc;
+        scope_depth++;
 }
 
 static void leave_scope(void) {
-        scope = scope->next;
+        table_pop(&var_table);
+        table_pop(&tag_table);
+        scope_depth--;
 }
 
 // Find a variable based on name
 static var_scope *find_var(Token *token) {
-        for (Scope *sc = scope; sc; sc = sc->next)
-                for (var_scope *sc2 = sc->vars; sc2; sc2 = sc2->next)
-                        if (equal(token, sc2->name))
-                                return sc2;
-        return NULL;
+        return (var_scope *)table_find(&var_table, token->ident);
 }
 
 static Type *find_tag(Token *token) {
-        for (Scope *sc = scope; sc; sc = sc->next)
-                for (tag_scope *sc2 = sc->tags; sc2; sc2 = sc2->next)
-                        if (equal(token, sc2->name))
-                                return sc2->type;
-        return NULL;
+        tag_scope *sc = (tag_scope *)table_find(&tag_table, token->ident);
+        return sc ? sc->type : NULL;
+}
+
+// Block scope entries live as long as the AST of their function, so
+// they are allocated along with it
+static Arena *scope_arena(void) {
+        return scope_depth ? &node_arena : &symbol_arena;
 }
 
-// TODO: free var_scopes
 static var_scope *push_scope(char *name) {
-        var_scope *sc = calloc(1, sizeof(var_scope));
-        if (sc == NULL)
-                error("not enough memory in system to allocate var scope");
-        sc->name = name;
-        sc->next = scope->vars;
-        scope->vars = sc;
+        var_scope *sc = arena_alloc(scope_arena(), sizeof(var_scope));
+        table_push(&var_table, &sc->entry, name);
         return sc;
 }
 
 static Node *new_node(NodeType type, Token *token) {
-        Node* node = calloc(1, sizeof(Node));
-        if (node == NULL) {
-                error("not enough memory in system");
-        }
+        Node *node = arena_alloc(&node_arena, sizeof(Node));
         node->node_type = type;
         node->token = token;
         return node;
 }
 
-void free_node(Node *node) {
-        if (!node) return;
-        free_node(node->left);
-        free(node->type);
-        free_node(node->right);
-        free(node->type);
-        free(node);
-}
-
 
 static Node *new_binary(NodeType type, Node *left, Node *right, Token *token) {
         Node *node = new_node(type, token);
@@ -165,24 +269,18 @@ static Node *new_var_node(Obj *var, Token *token) {
         return node;
 }
 
-// TODO: free cast nodes
 Node *new_cast(Node *expr, Type *type) {
         add_type(expr);
 
-        Node *node = calloc(1, sizeof(Node));
-        if (node == NULL)
-                error("not enough memory in system for cast");
-        node->node_type = ND_CAST;
-        node->token = expr->token;
+        Node *node = new_node(ND_CAST, expr->token);
         node->left = expr;
-        node->type = copy_type(type);
+        node->type = type;
+        fold_constant(node);
         return node;
 }
 
-static Obj *new_var(char *name, Type *type) {
-        Obj *var = calloc(1, sizeof(Obj));
-        if (var == NULL)
-                error("not enough memory in system for var");
+static Obj *new_var(Arena *arena, char *name, Type *type) {
+        Obj *var = arena_alloc(arena, sizeof(Obj));
         var->name = name;
         var->type = type;
         push_scope(name)->var = var;
@@ -190,7 +288,7 @@ static Obj *new_var(char *name, Type *type) {
 }
 
 static Obj *new_lvar(char *name, Type *type) {
-        Obj* var = new_var(name, type);
+        Obj* var = new_var(&node_arena, name, type);
         var->is_local = true;
         var->next = locals;
 
@@ -199,18 +297,12 @@ static Obj *new_lvar(char *name, Type *type) {
 }
 
 static Obj *new_gvar(char *name, Type *type) {
-        Obj *var = new_var(name, type);
+        Obj *var = new_var(&symbol_arena, name, type);
         var->next = globals;
         globals = var;
         return var;
 }
 
-void free_lvar(Obj *locals) {
-        if (!locals) return;
-        free_lvar(locals->next);
-        free(locals);
-}
-
 static Node *new_unary(NodeType type, Node *expr, Token *token) {
         Node *node = new_node(type, token);
         node->left = expr;
@@ -218,12 +310,13 @@ static Node *new_unary(NodeType type, Node *expr, Token *token) {
 }
 
 static char *new_unique_name(void) {
-        static int id = 0;
-        return format(".L..%d", id++);
+        return format(".L..%d", unique_name_count++);
 }
 
 static Obj *new_anon_gvar(Type *type) {
-        return new_gvar(new_unique_name(), type);
+        Obj *var = new_gvar(new_unique_name(), type);
+        var->is_static = true;
+        return var;
 }
 
 static Obj *new_string_literal(char *p, Type *type) {
@@ -235,7 +328,7 @@ static Obj *new_string_literal(char *p, Type *type) {
 static char *get_ident(Token *token) {
         if (token->token_type != T_IDENT)
                 error_tok(token, "expected an identifier");
-        return strndup(token->loc, token->len);
+        return token->ident;
 }
 
 static Type *find_typedef(Token *token) {
@@ -247,20 +340,10 @@ static Type *find_typedef(Token *token) {
         return NULL;
 }
 
-static long get_number(Token *token) {
-        if (token->token_type != T_NUM)
-                error_tok(token, "expected a number");
-        return token->val;
-}
-
 static void push_tag_scope(Token *token, Type *type) {
-        tag_scope *sc = calloc(1, sizeof(tag_scope));
-        if (sc == NULL)
-                error("not enough memory in system to allocate struct tag");
-        sc->name = strndup(token->loc, token->len);
+        tag_scope *sc = arena_alloc(scope_arena(), sizeof(tag_scope));
         sc->type = type;
-        sc->next = scope->tags;
-        scope->tags = sc;
+        table_push(&tag_table, &sc->entry, token->ident);
 }
 
 // declaration-specifier = ("void" | "_Bool" | "char" | "short" | "int" | "long"
@@ -287,53 +370,61 @@ static Type *declaration_specifier(Token **rest, Token *token, var_attribute *at
 
         while (is_typename(token)) {
                 // Handle storage class specifiers
-                if (equal(token, "typedef") || equal(token, "static")) {
+                if (token->id == TK_TYPEDEF || token->id == TK_STATIC) {
                         if (!attribute) 
                                 error_tok(token, "storage class specifier is not allowed in this context");
-                        if (equal(token, "typedef"))
+                        if (token->id == TK_TYPEDEF)
                                 attribute->is_typedef = true;
                         else
                                 attribute->is_static = true;
 
                         if (attribute->is_typedef + attribute->is_static > 1)
                                 error_tok(token, "typedef and static may not be used together");
-                        token = token->next;
+                        token++;
 
                         continue;
                 }
                 Type *type2 = find_typedef(token);
-                if (equal(token, "struct") || equal(token, "union") || equal(token, "enum") || type2) {
+                if (token->id == TK_STRUCT || token->id == TK_UNION || token->id == TK_ENUM || type2) {
                         if (counter)
                                 break;
-                        if (equal(token, "struct"))
-                                type = struct_declaration(&token, token->next);
-                        else if (equal(token, "union")) 
-                                type = union_declaration(&token, token->next);
-                        else if (equal(token, "enum")) {
-                                type = enum_specifier(&token, token->next);
+                        if (token->id == TK_STRUCT)
+                                type = struct_declaration(&token, token + 1);
+                        else if (token->id == TK_UNION) 
+                                type = union_declaration(&token, token + 1);
+                        else if (token->id == TK_ENUM) {
+                                type = enum_specifier(&token, token + 1);
                         } else {
                                 type = type2;
-                                token = token->next;
+                                token++;
                         }
 
                         counter += OTHER;
                         continue;
                 }
 
-                if (equal(token, "void"))
-                        counter += VOID;
-                else if (equal(token, "_Bool"))
-                        counter += BOOL;
-                else if (equal(token, "char"))
-                        counter += CHAR;
-                else if (equal (token, "short"))
-                        counter += SHORT;
-                else if (equal(token, "int"))
-                        counter += INT;
-                else if (equal(token, "long"))
-                        counter += LONG;
-                else
-                        unreachable();
+                switch (token->id) {
+                        case TK_VOID:
+                                counter += VOID;
+                                break;
+                        case TK_BOOL:
+                                counter += BOOL;
+                                break;
+                        case TK_CHAR:
+                                counter += CHAR;
+                                break;
+                        case TK_SHORT:
+                                counter += SHORT;
+                                break;
+                        case TK_INT:
+                                counter += INT;
+                                break;
+                        case TK_LONG:
+                                counter += LONG;
+                                break;
+                        default:
+                                unreachable();
+                }
 
                 switch (counter) {
                         case VOID:
@@ -361,7 +452,7 @@ static Type *declaration_specifier(Token **rest, Token *token, var_attribute *at
                         default:
                                 error_tok(token, "invalid type");
                 }
-                token = token->next;
+                token++;
         }
 
         *rest = token;
@@ -371,40 +462,38 @@ static Type *declaration_specifier(Token **rest, Token *token, var_attribute *at
 // func-params = (param ("," param)*)? ")"
 // param       = declaration-specifier declarator
 static Type *func_params(Token **rest, Token *token, Type *type) {
-        Type head = {};
-        Type *cur = &head;
+        Param head = {};
+        Param *cur = &head;
 
-        while (!equal(token, ")")) {
+        while (token->id != ')') {
                 if (cur != &head)
-                        token = skip(token, ",");
-                Type *type2 = declaration_specifier(&token, token, NULL);
-                type2 = declarator(&token, token, type2);
+                        token = skip(token, ',');
+                Param *param = arena_alloc(&type_arena, sizeof(Param));
+                param->type = declaration_specifier(&token, token, NULL);
+                param->type = declarator(&token, token, param->type, &param->name);
 
                 // Array of "T" is converted to pointer of "T" only in the parameter
                 // context. For example, *argv[] is converted to **argv by this.
-                if (type2->kind == TY_ARRAY) {
-                        Token *name = type2->name;
-                        type2 = pointer_to(type2->base);
-                        type2->name = name;
-                }
+                if (param->type->kind == TY_ARRAY)
+                        param->type = pointer_to(param->type->base);
 
-                cur = cur->next = copy_type(type2);
+                cur = cur->next = param;
         }
 
         type = func_type(type);
         type->params = head.next;
-        *rest = token->next;
+        *rest = token + 1;
         return type;
 }
 
-// array-dimensions = num? "]" type-suffix
+// array-dimensions = const-expr? "]" type-suffix
 static Type *array_dimensions(Token **rest, Token *token, Type *type) {
-        if (equal(token, "]")) {
-                type = type_suffix(rest, token->next, type);
+        if (token->id == ']') {
+                type = type_suffix(rest, token + 1, type);
                 return array_of(type, -1);
         }
-        int sz = get_number(token);
-        token = skip(token->next, "]");
+        int sz = const_expr(&token, token);
+        token = skip(token, ']');
         type = type_suffix(rest, token, type);
         return array_of(type, sz);
 }
@@ -413,11 +502,11 @@ static Type *array_dimensions(Token **rest, Token *token, Type *type) {
 //             | "[" array-dimensions
 //             | ε
 static Type *type_suffix(Token **rest, Token *token, Type *type) {
-        if (equal(token, "(")) 
-                return func_params(rest, token->next, type);
+        if (token->id == '(') 
+                return func_params(rest, token + 1, type);
 
-        if (equal(token, "[")) {
-                return array_dimensions(rest, token->next, type);
+        if (token->id == '[') {
+                return array_dimensions(rest, token + 1, type);
         }
 
         *rest = token;
@@ -425,40 +514,43 @@ static Type *type_suffix(Token **rest, Token *token, Type *type) {
 }
 
 // declarator = "*"* ("(" ident ")" | "(" declarator ")" | ident) type-suffix
-static Type *declarator(Token **rest, Token *token, Type *type) {
-        while (consume(&token, token, "*"))
+//
+// The declared name is returned in `name`. Types are shared between
+// declarations, so the name can't be stored in the type itself.
+static Type *declarator(Token **rest, Token *token, Type *type, Token **name) {
+        while (consume(&token, token, '*'))
                 type = pointer_to(type);
 
-        if (equal(token, "(")) {
+        if (token->id == '(') {
+                // Skip the nested declarator to find the type suffix,
+                // then parse it again with the real base type
                 Token *start = token;
-                Type dummy = {};
-                declarator(&token, start->next, &dummy);
-                token = skip(token, ")");
+                declarator(&token, start + 1, ty_int, NULL);
+                token = skip(token, ')');
                 type = type_suffix(rest, token, type);
-                return declarator(&token, start->next, type);
+                return declarator(&token, start + 1, type, name);
         }
         if (token->token_type != T_IDENT)
                 error_tok(token, "expected a variable name");
 
-        type = type_suffix(rest, token->next, type);
-        type->name = token;
-        return type;
+        if (name)
+                *name = token;
+        return type_suffix(rest, token + 1, type);
 }
 
 // abstract-declarator = "*" ("(" abstract-declarator ")")? type-suffix
 static Type *abstract_declarator(Token **rest, Token *token, Type *type) {
-        while (equal(token, "*")) {
+        while (token->id == '*') {
                 type = pointer_to(type);
-                token = token->next;
+                token++;
         }
 
-        if (equal(token, "(")) {
+        if (token->id == '(') {
                 Token *start = token;
-                Type dummy = {};
-                abstract_declarator(&token, start->next, &dummy);
-                token = skip(token, ")");
+                abstract_declarator(&token, start + 1, ty_int);
+                token = skip(token, ')');
                 type = type_suffix(rest, token, type);
-                return abstract_declarator(&token, start->next, type);
+                return abstract_declarator(&token, start + 1, type);
         }
 
         return type_suffix(rest, token, type);
@@ -479,10 +571,10 @@ static Type *enum_specifier(Token **rest, Token *token) {
         Token *tag = NULL;
         if (token->token_type == T_IDENT) {
                 tag = token;
-                token = token->next;
+                token++;
         }
 
-        if (tag && !equal(token, "{")) {
+        if (tag && token->id != '{') {
                 Type *type = find_tag(tag);
                 if (!type)
                         error_tok(tag, "unknown enum type");
@@ -492,28 +584,26 @@ static Type *enum_specifier(Token **rest, Token *token) {
                 return type;
         }
 
-        token = skip(token, "{");
+        token = skip(token, '{');
 
         // Read an enum-list
         int i = 0;
         int val = 0;
-        while (!equal(token, "}")) {
+        while (token->id != '}') {
                 if (i++ > 0)
-                        token = skip(token, ",");
+                        token = skip(token, ',');
                 char *name = get_ident(token);
-                token = token->next;
+                token++;
 
-                if (equal(token, "=")) {
-                        val = get_number(token->next);
-                        token = token->next->next;
-                }
+                if (token->id == '=')
+                        val = const_expr(&token, token + 1);
 
                 var_scope *sc = push_scope(name);
                 sc->enum_type = type;
                 sc->enum_val = val++;
         }
 
-        *rest = token->next;
+        *rest = token + 1;
 
         if (tag)
                 push_tag_scope(tag, type);
@@ -526,42 +616,49 @@ static Node *declaration(Token **rest, Token *token, Type *basetype) {
         Node *cur = &head;
         int i = 0;
 
-        while (!equal(token, ";")) {
+        while (token->id != ';') {
                 if (i++ > 0)
-                        token = skip(token, ",");
+                        token = skip(token, ',');
 
-                Type *type = declarator(&token, token, basetype);
+                Token *name;
+                Type *type = declarator(&token, token, basetype, &name);
                 if (type->size < 0)
                         error_tok(token, "variable has incomplete type");
                 if (type->kind == TY_VOID)
                         error_tok(token, "variable declared void");
-                Obj *var = new_lvar(get_ident(type->name), type);
+                Obj *var = new_lvar(get_ident(name), type);
 
-                if (!equal(token, "="))
+                if (token->id != '=')
                         continue;
 
-                Node *left = new_var_node(var, type->name);
-                Node *right = assign(&token, token->next);
+                Node *left = new_var_node(var, name);
+                Node *right = assign(&token, token + 1);
                 Node *node = new_binary(ND_ASSIGN, left, right, token);
                 cur = cur->next = new_unary(ND_STATEMENT, node, token);
         }
 
         Node *node = new_node(ND_BLOCK, token);
         node->body = head.next;
-        *rest = token->next;
+        *rest = token + 1;
         return node;
 }
 
 // Returns true if token represents a type
 static bool is_typename(Token *token) {
-        static char *typenames[] = { 
-                "void", "_Bool", "char", "short", "int", "long", "struct", "union", 
-                "typedef", "enum", "static",
-        };
-
-        for (int i = 0; i < sizeof(typenames) / sizeof(*typenames); i++)
-                if (equal(token, typenames[i]))
+        switch (token->id) {
+                case TK_VOID:
+                case TK_BOOL:
+                case TK_CHAR:
+                case TK_SHORT:
+                case TK_INT:
+                case TK_LONG:
+                case TK_STRUCT:
+                case TK_UNION:
+                case TK_TYPEDEF:
+                case TK_ENUM:
+                case TK_STATIC:
                         return true;
+        }
         return find_typedef(token);
 }
 
@@ -572,32 +669,32 @@ static bool is_typename(Token *token) {
 //        | "{" compound-stmt
 //        | expr->stmt
 static Node *statement(Token **rest, Token *token) {
-        if (equal(token, "return")) {
+        if (token->id == TK_RETURN) {
                 Node *node = new_node(ND_RETURN, token);
-                Node *exp = expr(&token, token->next);
-                *rest = skip(token, ";");
+                Node *exp = expr(&token, token + 1);
+                *rest = skip(token, ';');
 
                 add_type(exp);
                 node->left = new_cast(exp, current_func->type->return_type);
                 return node;
         }
 
-        if (equal(token, "if")) {
+        if (token->id == TK_IF) {
                 Node *node = new_node(ND_IF, token);
-                token = skip(token->next, "(");
+                token = skip(token + 1, '(');
                 node->cond = expr(&token, token);
-                token = skip(token, ")");
+                token = skip(token, ')');
                 node->then = statement(&token, token);
 
-                if (equal(token, "else"))
-                        node->els = statement(&token, token->next);
+                if (token->id == TK_ELSE)
+                        node->els = statement(&token, token + 1);
                 *rest = token;
                 return node;
         }
 
-        if (equal(token, "for")) {
+        if (token->id == TK_FOR) {
                 Node *node = new_node(ND_FOR, token);
-                token = skip(token->next, "(");
+                token = skip(token + 1, '(');
 
                 enter_scope();
 
@@ -608,30 +705,30 @@ static Node *statement(Token **rest, Token *token) {
                         node->init = expr_statement(&token, token);
                 }
 
-                if (!equal(token, ";"))
+                if (token->id != ';')
                         node->cond = expr(&token, token);
-                token = skip(token, ";");
+                token = skip(token, ';');
 
-                if (!equal(token, ")"))
+                if (token->id != ')')
                         node->inc = expr(&token, token);
-                token = skip(token, ")");
+                token = skip(token, ')');
 
                 node->then = statement(rest, token);
                 leave_scope();
                 return node;
         }
 
-        if (equal(token, "while")) {
+        if (token->id == TK_WHILE) {
                 Node *node = new_node(ND_FOR, token);
-                token = skip(token->next, "(");
+                token = skip(token + 1, '(');
                 node->cond = expr(&token, token);
-                token = skip(token, ")");
+                token = skip(token, ')');
                 node->then = statement(rest, token);
                 return node;
         }
 
-        if (equal(token, "{"))
-                return compound_statement(rest, token->next);
+        if (token->id == '{')
+                return compound_statement(rest, token + 1);
 
         return expr_statement(rest, token);
 }
@@ -644,7 +741,7 @@ static Node *compound_statement(Token **rest, Token* token) {
 
         enter_scope();
 
-        while (!equal(token, "}")) {
+        while (token->id != '}') {
                 if (is_typename(token)) {
                         var_attribute attribute = {};
                         Type *basetype = declaration_specifier(&token, token, &attribute);
@@ -662,38 +759,43 @@ static Node *compound_statement(Token **rest, Token* token) {
 
         leave_scope();
         node->body = head.next;
-        *rest = token->next;
+        *rest = token + 1;
         return node;
 }
 
 // expr-statement = expr? ";"
 static Node *expr_statement(Token **rest, Token *token) {
-        if (equal(token, ";")) {
-                *rest = token->next;
+        if (token->id == ';') {
+                *rest = token + 1;
                 return new_node(ND_NULL_STATEMENT, token);
         }
         Node *node = new_node(ND_STATEMENT, token);
         node->left = expr(&token, token);
-        *rest = skip(token, ";");
+        *rest = skip(token, ';');
         return node;
 }
 
 // expr = assign ("," expr)?
 static Node *expr(Token **rest, Token *token) {
         Node *node = assign(&token, token);
-        if (equal(token, ","))
-                return new_binary(ND_COMMA, node, expr(rest, token->next), token);
+        if (token->id == ',')
+                return new_binary(ND_COMMA, node, expr(rest, token + 1), token);
         *rest = token;
         return node;
 }
 
 // Convert `A op=B` to `tmp = &A, *tmp = *tmp op B`
-// where tmp is a fresh pointer variable.
+// where tmp is a fresh pointer variable. At -O1, a plain variable can be
+// read twice without side effects, so it becomes `A = A op B` instead
+// and does not have its address taken.
 static Node *to_assign(Node *binary) {
         add_type(binary->left);
         add_type(binary->right);
         Token *token = binary->token;
 
+        if (opt_level && binary->left->node_type == ND_VAR)
+                return new_binary(ND_ASSIGN, new_var_node(binary->left->var, token), binary, token);
+
         Obj *var = new_lvar("", pointer_to(binary->left->type));
 
         Node *expr1 = new_binary(ND_ASSIGN, new_var_node(var, token),
@@ -713,146 +815,39 @@ static Node *to_assign(Node *binary) {
 // assign = logor (assign-op assign)?
 // assign-op = "=" | "+=" | "-=" | "*=" | "/=" | "%=" | "&=" | "|=" | "^="
 static Node *assign(Token **rest, Token *token) {
-        Node *node = logor(&token, token);
-        if (equal(token, "=")) {
-                node = new_binary(ND_ASSIGN, node, assign(&token, token->next), token);
+        Node *node = binary(&token, token, PREC_LOGOR);
+        if (token->id == '=') {
+                node = new_binary(ND_ASSIGN, node, assign(&token, token + 1), token);
         }
 
-        if (equal(token, "+="))
-                return to_assign(new_add(node, assign(rest, token->next), token));
-
-        if (equal(token, "-="))
-                return to_assign(new_sub(node, assign(rest, token->next), token));
-
-        if (equal(token, "*="))
-                return to_assign(new_binary(ND_MUL, node, assign(rest, token->next), token));
-
-        if (equal(token, "/=")) 
-                return to_assign(new_binary(ND_DIV, node, assign(rest, token->next), token));
-
-        if (equal(token, "%="))
-                return to_assign(new_binary(ND_MOD, node, assign(rest, token->next), token));
+        if (token->id == TK_ADD_ASSIGN)
+                return to_assign(new_add(node, assign(rest, token + 1), token));
 
-        if (equal(token, "&="))
-                return to_assign(new_binary(ND_BITAND, node, assign(rest, token->next), token)); 
+        if (token->id == TK_SUB_ASSIGN)
+                return to_assign(new_sub(node, assign(rest, token + 1), token));
 
-        if (equal(token, "|="))
-                return to_assign(new_binary(ND_BITOR, node, assign(rest, token->next), token));
+        if (token->id == TK_MUL_ASSIGN)
+                return to_assign(new_binary(ND_MUL, node, assign(rest, token + 1), token));
 
-        if (equal(token, "^="))
-                return to_assign(new_binary(ND_BITXOR, node, assign(rest, token->next), token));
+        if (token->id == TK_DIV_ASSIGN) 
+                return to_assign(new_binary(ND_DIV, node, assign(rest, token + 1), token));
 
-        *rest = token;
-        return node;
-}
+        if (token->id == TK_MOD_ASSIGN)
+                return to_assign(new_binary(ND_MOD, node, assign(rest, token + 1), token));
 
-// logor = logand ("||" logand)*
-static Node *logor(Token **rest, Token *token) {
-        Node *node = logand(&token, token);
-        while (equal(token, "||")) {
-                Token *start = token;
-                node = new_binary(ND_LOGOR, node, logand(&token, token->next), start);
-        }
-        *rest = token;
-        return node;
-}
-
-// logand = bitor ("&&" bitor)*
-static Node *logand(Token **rest, Token *token) {
-        Node *node = bitor(&token, token);
-        while (equal(token, "&&")) {
-                Token *start = token;
-                node = new_binary(ND_LOGAND, node, bitor(&token, token->next), start);
-        }
-        *rest = token;
-        return node;
-}
+        if (token->id == TK_AND_ASSIGN)
+                return to_assign(new_binary(ND_BITAND, node, assign(rest, token + 1), token)); 
 
-// bitor = bitxor ("|" bitxor)*
-static Node *bitor(Token **rest, Token *token) {
-        Node *node = bitxor(&token, token);
-        while (equal(token, "|")) {
-                Token *start = token;
-                node = new_binary(ND_BITOR, node, bitxor(&token, token->next), start);
-        }
-        *rest = token;
-        return node;
-}
+        if (token->id == TK_OR_ASSIGN)
+                return to_assign(new_binary(ND_BITOR, node, assign(rest, token + 1), token));
 
-// bitxor = bitand ("^" bitand)*
-static Node *bitxor(Token **rest, Token *token) {
-        Node *node = bitand(&token, token);
-        while (equal(token, "^")) {
-                Token *start = token;
-                node = new_binary(ND_BITXOR, node, bitand(&token, token->next), start);
-        }
-        *rest = token;
-        return node;
-}
+        if (token->id == TK_XOR_ASSIGN)
+                return to_assign(new_binary(ND_BITXOR, node, assign(rest, token + 1), token));
 
-// bitand = equality ("&" equality)*
-static Node *bitand(Token **rest, Token *token) {
-        Node *node = equality(&token, token);
-        while (equal(token, "&")) {
-                Token *start = token;
-                node = new_binary(ND_BITAND, node, equality(&token, token->next), start);
-        }
         *rest = token;
         return node;
 }
 
-
-// equality = relational ("==" relational | "!=" relational)* 
-static Node *equality(Token **rest, Token *token) {
-        Node *node = relational(&token, token);
-        for (;;) {
-                Token *start = token;
-                if (equal(token, "==")) {
-                        node = new_binary(ND_EQ, node, relational(&token, token->next), start);
-                        continue;
-                }
-
-                if (equal(token, "!=")) {
-                        node = new_binary(ND_NE, node, relational(&token, token->next), start);
-                        continue;
-                }
-
-                *rest = token;
-                return node;
-        }
-}
-
-// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
-static Node *relational(Token **rest, Token *token) {
-        Node *node = add(&token, token);
-
-        for (;;) {
-                Token *start = token;
-                if (equal(token, "<")) {
-                        node = new_binary(ND_LT, node, add(&token, token->next), start);
-                        continue;
-                }
-
-                if (equal(token, "<=")) {
-                        node = new_binary(ND_LE, node, add(&token, token->next), start);
-                        continue;
-                }
-
-                if (equal(token, ">")) {
-                        node = new_binary(ND_LT, add(&token, token->next), node, start);
-                        continue;
-                }
-
-                if (equal(token, ">=")) {
-                        node = new_binary(ND_LE, add(&token, token->next), node, start);
-                        continue;
-                }
-
-                *rest = token;
-                return node;
-        }
-}
-
 // In C, '+' operator is overloaded to do pointer arithmetic
 // if p is a pointer, p + n adds not n but sizeof(*p)*n to the value of p,
 // so that p + n points to the location n elements ahead of p
@@ -908,58 +903,87 @@ static Node *new_sub(Node *left, Node *right, Token *token) {
         error_tok(token, "invalid operands");
 }
 
-// add = mul ("+" mul | "-" mul)*
-static Node *add(Token **rest, Token *token) {
-        Node *node = mul(&token, token);
-        for (;;) {
-                Token *start = token;
-                if (equal(token, "+")) {
-                        node = new_add(node, mul(&token, token->next), start);
-                        continue;
-                }
+// const-expr = logor, which must evaluate to a number at compile time
+static int64_t const_expr(Token **rest, Token *token) {
+        Node *node = binary(rest, token, PREC_LOGOR);
+        add_type(node);
+        if (node->node_type != ND_NUM)
+                error_tok(token, "expected a constant expression");
+        return node->val;
+}
+
+// Binary operators are parsed by precedence climbing over this table
+// instead of one function per precedence level:
+//
+// logor      = logand ("||" logand)*
+// logand     = bitor ("&&" bitor)*
+// bitor      = bitxor ("|" bitxor)*
+// bitxor     = bitand ("^" bitand)*
+// bitand     = equality ("&" equality)*
+// equality   = relational ("==" relational | "!=" relational)*
+// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
+// add        = mul ("+" mul | "-" mul)*
+// mul        = cast ("*" cast | "/" cast | "%" cast)*
+typedef struct {
+        uint8_t prec; // 0 if the token is not a binary operator
+        uint8_t node_type;
+} BinaryOp;
+
+static BinaryOp binary_ops[TK_ID_COUNT] = {
+        [TK_LOGOR] = {PREC_LOGOR, ND_LOGOR},
+        [TK_LOGAND] = {PREC_LOGAND, ND_LOGAND},
+        ['|'] = {PREC_BITOR, ND_BITOR},
+        ['^'] = {PREC_BITXOR, ND_BITXOR},
+        ['&'] = {PREC_BITAND, ND_BITAND},
+        [TK_EQ] = {PREC_EQUALITY, ND_EQ},
+        [TK_NE] = {PREC_EQUALITY, ND_NE},
+        ['<'] = {PREC_RELATIONAL, ND_LT},
+        [TK_LE] = {PREC_RELATIONAL, ND_LE},
+        ['>'] = {PREC_RELATIONAL, ND_LT}, // Operands swapped
+        [TK_GE] = {PREC_RELATIONAL, ND_LE}, // Operands swapped
+        ['+'] = {PREC_ADD, ND_ADD},
+        ['-'] = {PREC_ADD, ND_SUB},
+        ['*'] = {PREC_MUL, ND_MUL},
+        ['/'] = {PREC_MUL, ND_DIV},
+        ['%'] = {PREC_MUL, ND_MOD},
+};
 
-                if (equal(token, "-")) {
-                        node = new_sub(node, mul(&token, token->next), start);
-                        continue;
-                }
-                *rest = token;
-                return node;
+static Node *new_binary_op(Token *op, Node *left, Node *right) {
+        switch (op->id) {
+                case '+':
+                        return new_add(left, right, op);
+                case '-':
+                        return new_sub(left, right, op);
+                case '>':
+                case TK_GE:
+                        return new_binary(binary_ops[op->id].node_type, right, left, op);
         }
+        return new_binary(binary_ops[op->id].node_type, left, right, op);
 }
 
-// mul = cast ("*" cast | "/" cast | "%" cast)*
-static Node *mul(Token **rest, Token *token) {
-        Node *node = cast(&token, token); 
-
+// Parses a chain of binary operators that bind at least as tightly as
+// `min_prec`. All of them are left-associative, so the right operand of
+// an operator only takes operators that bind more tightly than it.
+static Node *binary(Token **rest, Token *token, int min_prec) {
+        Node *node = cast(&token, token);
         for (;;) {
-                Token *start = token;
-
-                if (equal(token, "*")) {
-                        node = new_binary(ND_MUL, node, cast(&token, token->next), start);
-                        continue;
-                }
-
-                if (equal(token, "/")) {
-                        node = new_binary(ND_DIV, node, cast(&token, token->next), start);
-                        continue;
-                }
-
-                if (equal(token, "%")) {
-                        node = new_binary(ND_MOD, node, cast(&token, token->next), start);
-                        continue;
-                }
-
-                *rest = token;
-                return node;
+                Token *op = token;
+                int prec = binary_ops[op->id].prec;
+                if (prec < min_prec)
+                        break;
+                Node *right = binary(&token, op + 1, prec + 1);
+                node = new_binary_op(op, node, right);
         }
+        *rest = token;
+        return node;
 }
 
 // cast = "(" type-name ")" cast | unary
 static Node *cast(Token **rest, Token *token) {
-        if (equal(token, "(") && is_typename(token->next)) {
+        if (token->id == '(' && is_typename(token + 1)) {
                 Token *start = token;
-                Type *type = typename(&token, token->next);
-                token = skip(token, ")");
+                Type *type = typename(&token, token + 1);
+                token = skip(token, ')');
                 Node *node = new_cast(cast(rest, token), type);
                 node->token = start;
                 return node;
@@ -972,56 +996,53 @@ static Node *cast(Token **rest, Token *token) {
 //       | ("++" | "--") unary
 //       | postfix
 static Node *unary(Token **rest, Token *token) {
-        if (equal(token, "+")) 
-                return cast(rest, token->next);
-        if (equal(token, "-")) 
-                return new_unary(ND_NEG, cast(rest, token->next), token);
-        if (equal(token, "&")) 
-                return new_unary(ND_ADDRESS, cast(rest, token->next), token);
-        if (equal(token, "*")) 
-                return new_unary(ND_DEREF, cast(rest, token->next), token);
-
-        if (equal(token, "!"))
-                return new_unary(ND_NOT, cast(rest, token->next), token);
-        if (equal(token, "~"))
-                return new_unary(ND_BITNOT, cast(rest, token->next), token);
+        if (token->id == '+') 
+                return cast(rest, token + 1);
+        if (token->id == '-') 
+                return new_unary(ND_NEG, cast(rest, token + 1), token);
+        if (token->id == '&') 
+                return new_unary(ND_ADDRESS, cast(rest, token + 1), token);
+        if (token->id == '*') 
+                return new_unary(ND_DEREF, cast(rest, token + 1), token);
+
+        if (token->id == '!')
+                return new_unary(ND_NOT, cast(rest, token + 1), token);
+        if (token->id == '~')
+                return new_unary(ND_BITNOT, cast(rest, token + 1), token);
 
         // Read ++i as i += 1
-        if (equal(token, "++"))
-                return to_assign(new_add(unary(rest, token->next), new_num(1, token), token));
+        if (token->id == TK_INC)
+                return to_assign(new_add(unary(rest, token + 1), new_num(1, token), token));
 
         // Read --i as i -= 1
-        if (equal(token, "--"))
-                return to_assign(new_sub(unary(rest, token->next), new_num(1, token), token));
+        if (token->id == TK_DEC)
+                return to_assign(new_sub(unary(rest, token + 1), new_num(1, token), token));
 
         return postfix(rest, token);
 }
 
 
-// TODO: free struct memory
 // struct-members = (declaration-specifier declarator ("," declarator)* ";")*
 static void struct_members(Token **rest, Token *token, Type *type) {
         Member head = {};
         Member *cur = &head;
 
-        while (!equal(token, "}")) {
+        while (token->id != '}') {
                 Type *basetype = declaration_specifier(&token, token, NULL);
                 int i = 0;
 
-                while (!consume(&token, token, ";")) {
+                while (!consume(&token, token, ';')) {
                         if (i++)
-                                token = skip(token, ",");
+                                token = skip(token, ',');
 
-                        Member *member = calloc(1, sizeof(Member));
-                        if (member == NULL)
-                                error("not enough memory to allocate for member");
-                        member->type = declarator(&token, token, basetype);
-                        member->name = member->type->name;
+                        Member *member = arena_alloc(&type_arena, sizeof(Member));
+                        member->type = declarator(&token, token, basetype, &member->token);
+                        member->name = member->token->ident;
                         cur = cur->next = member;
                 }
         }
 
-        *rest = token->next;
+        *rest = token + 1;
         type->members = head.next;
 }
 
@@ -1031,10 +1052,10 @@ static Type *struct_union_declaration(Token **rest, Token *token) {
         Token *tag = NULL;
         if (token->token_type == T_IDENT) {
                 tag = token;
-                token = token->next;
+                token++;
         }
 
-        if (tag && !equal(token, "{")) {
+        if (tag && token->id != '{') {
                 *rest = token;
                 Type *type = find_tag(tag);
                 if (type)
@@ -1045,7 +1066,7 @@ static Type *struct_union_declaration(Token **rest, Token *token) {
                 return type;
         }
 
-        token = skip(token, "{");
+        token = skip(token, '{');
 
         // Build struct object
         Type *type = struct_type();
@@ -1054,12 +1075,10 @@ static Type *struct_union_declaration(Token **rest, Token *token) {
         if (tag) {
                 // If this is a redefinition, overwrite a previous type
                 // Otherwise, register the struct type
-                for (tag_scope *sc= scope->tags; sc; sc = sc->next) {
-                        if (equal(tag, sc->name)) {
-                                *sc->type = *type;
-                                return sc->type;
-                        }
-
+                tag_scope *sc = (tag_scope *)table_find(&tag_table, tag->ident);
+                if (sc && sc->entry.depth == scope_depth) {
+                        *sc->type = *type;
+                        return sc->type;
                 }
                 push_tag_scope(tag, type);
         }
@@ -1109,9 +1128,10 @@ static Type *union_declaration(Token **rest, Token *token) {
 }
 
 static Member *get_struct_member(Type *type, Token *token) {
+        if (token->token_type != T_IDENT)
+                error_tok(token, "expected a member name");
         for (Member *member = type->members; member; member = member->next) 
-                if (member->name->len == token->len &&
-                                !strncmp(member->name->loc, token->loc, token->len))
+                if (member->name == token->ident)
                         return member;
         error_tok(token, "no such member");
 }
@@ -1139,38 +1159,38 @@ static Node *postfix(Token **rest, Token *token) {
         Node *node = primary(&token, token);
 
         for (;;) {
-                if (equal(token, "[")) {
+                if (token->id == '[') {
                         // x[y] is short for *(x + y)
                         Token *start = token;
-                        Node *index = expr(&token, token->next);
-                        token = skip(token, "]");
+                        Node *index = expr(&token, token + 1);
+                        token = skip(token, ']');
                         node = new_unary(ND_DEREF, new_add(node, index, start), start);
                         continue;
                 }
 
-                if (equal(token, ".")) {
-                        node = struct_ref(node, token->next);
-                        token = token->next->next;
+                if (token->id == '.') {
+                        node = struct_ref(node, token + 1);
+                        token = token + 2;
                         continue;
                 }
 
-                if (equal(token, "->")) {
+                if (token->id == TK_ARROW) {
                         // x->y is short for (*x).y
                         node = new_unary(ND_DEREF, node, token);
-                        node = struct_ref(node, token->next);
-                        token = token->next->next;
+                        node = struct_ref(node, token + 1);
+                        token = token + 2;
                         continue;
                 }
 
-                if (equal(token, "++")) {
+                if (token->id == TK_INC) {
                         node = new_inc_dec(node, token, 1);
-                        token = token->next;
+                        token++;
                         continue;
                 }
 
-                if (equal(token, "--")) {
+                if (token->id == TK_DEC) {
                         node = new_inc_dec(node, token, -1);
-                        token = token->next;
+                        token++;
                         continue;
                 }
 
@@ -1182,40 +1202,41 @@ static Node *postfix(Token **rest, Token *token) {
 // funcall = ident "(" (assign ("," assign)*)? ")"
 static Node *funcall(Token **rest, Token *token) {
         Token *start = token;
-        token = token->next->next;
+        token = token + 2;
 
         var_scope *sc = find_var(start);
         if (!sc)
                 error_tok(start, "implicit declaration of a function");
         if (!sc->var || sc->var->type->kind != TY_FUNC)
                 error_tok(start, "not a function");
+        sc->var->is_referenced = true;
 
         Type *type = sc->var->type;
-        Type *param_type = type->params;
+        Param *param = type->params;
 
         Node head = {};
         Node *cur = &head;
 
-        while (!equal(token, ")")) {
+        while (token->id != ')') {
                 if (cur != &head)
-                        token = skip(token, ",");
+                        token = skip(token, ',');
 
                 Node *arg = assign(&token, token);
                 add_type(arg);
 
-                if (param_type) {
-                        if (param_type->kind == TY_STRUCT || param_type->kind == TY_UNION)
+                if (param) {
+                        if (param->type->kind == TY_STRUCT || param->type->kind == TY_UNION)
                                 error_tok(arg->token, "passing struct or union is not supported yet");
-                        arg = new_cast(arg, param_type);
-                        param_type = param_type->next;
+                        arg = new_cast(arg, param->type);
+                        param = param->next;
                 }
                 cur = cur->next = arg;
         }
 
-        *rest = skip(token, ")");
+        *rest = skip(token, ')');
 
         Node *node = new_node(ND_FUNCALL, start);
-        node->funcname = strndup(start->loc, start->len);
+        node->funcname = start->ident;
         node->func_type = type;
         node->type = type->return_type;
         node->args = head.next;
@@ -1232,33 +1253,33 @@ static Node *funcall(Token **rest, Token *token) {
 static Node *primary(Token **rest, Token* token) {
         Token *start = token;
 
-        if (equal(token, "(") && equal(token->next, "{")) {
+        if (token->id == '(' && token[1].id == '{') {
                 Node *node = new_node(ND_STATEMENT_EXPRESSION, token);
-                node->body = compound_statement(&token, token->next->next)->body;
-                *rest = skip(token, ")");
+                node->body = compound_statement(&token, token + 2)->body;
+                *rest = skip(token, ')');
                 return node;
         }
-        if (equal(token, "(")) {
-                Node *node = expr(&token, token->next);
-                *rest = skip(token, ")");
+        if (token->id == '(') {
+                Node *node = expr(&token, token + 1);
+                *rest = skip(token, ')');
                 return node;
         }
 
-        if (equal(token, "sizeof") && equal(token->next, "(") && is_typename(token->next->next)) {
-                Type *type = typename(&token, token->next->next);
-                *rest = skip(token, ")");
+        if (token->id == TK_SIZEOF && token[1].id == '(' && is_typename(token + 2)) {
+                Type *type = typename(&token, token + 2);
+                *rest = skip(token, ')');
                 return new_num(type->size, start);
         }
 
-        if (equal(token, "sizeof")) {
-                Node *node = unary(rest, token->next);
+        if (token->id == TK_SIZEOF) {
+                Node *node = unary(rest, token + 1);
                 add_type(node);
                 return new_num(node->type->size, token);
         }
 
         if (token->token_type == T_IDENT) {
                 // Function call
-                if (equal(token->next, "(")) {
+                if (token[1].id == '(') {
                         return funcall(rest, token);
                 }
 
@@ -1269,24 +1290,27 @@ static Node *primary(Token **rest, Token* token) {
                         error_tok(token, "undefined variable");
 
                 Node *node;
-                if (sc->var)
+                if (sc->var) {
+                        sc->var->is_referenced = true;
                         node = new_var_node(sc->var, token);
+                }
                 else
                         node = new_num(sc->enum_val, token);
 
-                *rest = token->next;
+                *rest = token + 1;
                 return node;
         }
 
         if (token->token_type == T_STR) {
-                Obj *var = new_string_literal(token->str, token->type);
-                *rest = token->next;
+                Literal *literal = token_literal(token);
+                Obj *var = new_string_literal(literal->str, array_of(ty_char, literal->str_len));
+                *rest = token + 1;
                 return new_var_node(var, token);
         }
 
         if (token->token_type == T_NUM) {
-                Node *node = new_num(token->val, token);
-                *rest = token->next;
+                Node *node = new_num(token_literal(token)->val, token);
+                *rest = token + 1;
                 return node;
         } 
         error_tok(token, "expected an expression");
@@ -1296,79 +1320,187 @@ static Node *primary(Token **rest, Token* token) {
 static Token *parse_typedef(Token *token, Type *basetype) {
         bool first = true;
 
-        while (!consume(&token, token, ";")) {
+        while (!consume(&token, token, ';')) {
                 if (!first)
-                        token = skip(token, ",");
+                        token = skip(token, ',');
                 first = false;
-                Type *type = declarator(&token, token, basetype);
-                push_scope(get_ident(type->name))->type_def = type;
+                Token *name;
+                Type *type = declarator(&token, token, basetype, &name);
+                push_scope(get_ident(name))->type_def = type;
         }
         return token;
 }
 
-static void create_param_lvars(Type *param) {
+static void create_param_lvars(Param *param) {
         if (param) {
                 create_param_lvars(param->next);
-                new_lvar(get_ident(param->name), param);
+                new_lvar(get_ident(param->name), param->type);
         }
 }
 
-static Token *function(Token *token, Type *basetype, var_attribute *attribute) {
-        Type *type = declarator(&token, token, basetype);
-
-        Obj *func = new_gvar(get_ident(type->name), type);
-        func->is_function = true;
-        func->is_definition = !consume(&token, token, ";");
-        func->is_static = attribute->is_static;
-
-        if (!func->is_definition)
-                return token;
-
+static Token *function_body(Obj *func, Token *token) {
         current_func = func;
 
         locals = NULL;
         enter_scope();
 
-        create_param_lvars(type->params);
+        create_param_lvars(func->type->params);
         func->params = locals;
 
-        token = skip(token, "{");
+        token = skip(token, '{');
         func->body = compound_statement(&token, token);
         func->locals = locals;
         leave_scope();
+        if (function_done)
+                function_done(func);
         return token;
 }
 
-static Token *global_variable(Token *token, Type *basetype) {
-        bool first = true;
+// Returns the token after the braces starting at `token`
+static Token *skip_braces(Token *token) {
+        token = skip(token, '{');
+        for (int depth = 1; depth; token++) {
+                if (token->token_type == T_EOF)
+                        error_tok(token, "unterminated function body");
+                if (token->id == '{')
+                        depth++;
+                else if (token->id == '}')
+                        depth--;
+        }
+        return token;
+}
 
-        while (!consume(&token, token, ";")) {
-                if (!first)
-                        token = skip(token, ",");
-                first = false;
+static Token *function(Token *token, Type *type, Token *name, var_attribute *attribute) {
+        Obj *func = new_gvar(get_ident(name), type);
+        func->is_function = true;
+        func->is_definition = !consume(&token, token, ';');
+        func->is_static = attribute->is_static;
+
+        if (!func->is_definition)
+                return token;
 
-                Type *type = declarator(&token, token, basetype);
-                new_gvar(get_ident(type->name), type);
+        if (!lazy_bodies)
+                return function_body(func, token);
+
+        if (deferred_count == deferred_capacity) {
+                deferred_capacity = deferred_capacity ? deferred_capacity * 2 : 256;
+                deferred = realloc(deferred, sizeof(DeferredBody) * deferred_capacity);
+        }
+        deferred[deferred_count++] = (DeferredBody){func, var_table.count, tag_table.count};
+        func->body_token = token;
+        return skip_braces(token);
+}
+
+static Token *global_variable(Token *token, Type *basetype, Type *type, Token *name) {
+        new_gvar(get_ident(name), type);
+
+        while (!consume(&token, token, ';')) {
+                token = skip(token, ',');
+                type = declarator(&token, token, basetype, &name);
+                new_gvar(get_ident(name), type);
         }
         return token;
 }
 
-// Lookahead tokens and returns true if a given token is start
-// of a function definition or declaration
-static bool is_function(Token *token) {
-        if (equal(token->next, ";"))
-                return false;
 
-        Type dummy = {};
-        Type *type = declarator(&token, token, &dummy);
-        return type->kind == TY_FUNC;
+// Returns the file-scope declarations made so far in declaration order
+GlobalName *global_names(int *count) {
+        GlobalName *names = calloc(var_table.count + tag_table.count + 1, sizeof(GlobalName));
+        int n = 0;
+
+        for (int i = 0; i < var_table.count; i++) {
+                var_scope *sc = (var_scope *)var_table.log[i];
+                names[n++] = (GlobalName){sc->entry.name, sc->var, sc->type_def, sc->enum_type, sc->enum_val};
+        }
+        for (int i = 0; i < tag_table.count; i++) {
+                tag_scope *sc = (tag_scope *)tag_table.log[i];
+                names[n++] = (GlobalName){sc->entry.name, .tag = sc->type};
+        }
+        *count = n;
+        return names;
 }
 
+// Declares a name at file scope as if its declaration had been parsed
+void define_global_name(GlobalName *name) {
+        if (name->tag) {
+                tag_scope *sc = arena_alloc(&symbol_arena, sizeof(tag_scope));
+                sc->type = name->tag;
+                table_push(&tag_table, &sc->entry, name->name);
+                return;
+        }
 
-// program = (typedef | function-definition | global-variable)*
-Obj *parse(Token *token) {
-        globals = NULL;
+        if (name->var) {
+                Obj *var = new_gvar(name->name, name->var->type);
+                var->is_function = name->var->is_function;
+                var->is_static = name->var->is_static;
+                return;
+        }
+
+        var_scope *sc = push_scope(name->name);
+        sc->type_def = name->type_def;
+        sc->enum_type = name->enum_type;
+        sc->enum_val = name->enum_val;
+}
+
+// Returns true if a static function is named anywhere. A body sees the
+// declaration that was last when it was skipped, so every declaration of
+// the name counts.
+static bool is_referenced(Obj *func) {
+        if (func->is_referenced)
+                return true;
+        for (ScopeEntry *e = var_table.buckets[bucket_of(&var_table, func->name)]; e; e = e->next) {
+                var_scope *sc = (var_scope *)e;
+                if (e->name == func->name && sc->var && sc->var->is_referenced)
+                        return true;
+        }
+        return false;
+}
+
+// Parses a deferred body in the file scope as it was where the body is
+static void parse_deferred_body(DeferredBody *body) {
+        var_table.is_limited = tag_table.is_limited = true;
+        var_table.limit = body->var_count;
+        tag_table.limit = body->tag_count;
+        function_body(body->func, body->func->body_token);
+        body->func->body_token = NULL;
+        var_table.is_limited = tag_table.is_limited = false;
+}
+
+// Parses the deferred bodies that are needed: every non-static function,
+// and the static ones that are referenced from a needed body. Parsing a
+// body can make further static functions referenced, so this goes on
+// until a pass finds nothing new.
+static void parse_deferred_bodies(void) {
+        for (bool progress = true; progress;) {
+                progress = false;
+                for (int i = 0; i < deferred_count; i++) {
+                        Obj *func = deferred[i].func;
+                        if (!func->body_token || (func->is_static && !is_referenced(func)))
+                                continue;
+                        parse_deferred_body(&deferred[i]);
+                        progress = true;
+                }
+        }
+
+        // Static functions nobody calls are not emitted at all
+        for (int i = 0; i < deferred_count; i++) {
+                Obj *func = deferred[i].func;
+                if (func->body_token) {
+                        func->body_token = NULL;
+                        func->is_definition = false;
+                }
+        }
+        deferred_count = 0;
+}
 
+// program = (typedef | function-definition | global-variable)*
+// Parses a translation unit and returns its global objects. `done`,
+// if not NULL, gets every function definition as soon as it is parsed.
+// If `lazy` is set, function bodies are skipped over at first and only
+// parsed once every file-scope declaration has been seen.
+Obj *parse(Token *token, void (*done)(Obj *func), bool lazy) {
+        function_done = done;
+        lazy_bodies = lazy;
         while (token->token_type != T_EOF) {
                 var_attribute attribute = {};
                 Type *basetype = declaration_specifier(&token, token, &attribute);
@@ -1379,14 +1511,50 @@ Obj *parse(Token *token) {
                         continue;
                 }
 
+                // Declaration of a tag only
+                if (consume(&token, token, ';'))
+                        continue;
+
+                // The first declarator tells functions and variables apart
+                Token *name;
+                Type *type = declarator(&token, token, basetype, &name);
+
                 // Function
-                if (is_function(token)) {
-                        token = function(token, basetype, &attribute);
+                if (type->kind == TY_FUNC) {
+                        token = function(token, type, name, &attribute);
                         continue;
                 }
 
                 // Global variable
-                token = global_variable(token, basetype);
+                token = global_variable(token, basetype, type, name);
         }
+
+        if (lazy_bodies)
+                parse_deferred_bodies();
         return globals;
 }
+
+static void free_table(SymbolTable *table) {
+        free(table->buckets);
+        free(table->log);
+        *table = (SymbolTable){};
+}
+
+void set_parser_optimization(int level) {
+        opt_level = level;
+}
+
+// Forgets every name of the last translation unit, so the next one
+// starts with an empty global scope. The objects go away with the arenas.
+void reset_parser(void) {
+        free_table(&var_table);
+        free_table(&tag_table);
+        locals = globals = NULL;
+        scope_depth = 0;
+        current_func = NULL;
+        unique_name_count = 0;
+        function_done = NULL;
+        free(deferred);
+        deferred = NULL;
+        deferred_count = deferred_capacity = 0;
+}
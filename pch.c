@@ -0,0 +1,409 @@
+#include "token.h"
+
+// Precompiled headers. `--emit-pch` parses a prelude of declarations and
+// saves the file-scope names it declares, together with every type they
+// refer to, to a file. `--include-pch <file>` declares them again before
+// the input is parsed, without lexing or parsing the prelude.
+//
+// The file is a header followed by arrays of fixed-size records. Records
+// refer to each other by index and to names by offset into a string
+// table, so there are no pointers to relocate and the file is read in
+// place from a read-only mapping. Derived types are listed after the
+// type they are derived from, so the loader can build every type with
+// one forward pass and keep pointer and array types interned.
+
+#define PCH_MAGIC "SCCPCH1"
+
+typedef struct {
+        char magic[8];
+        uint32_t type_count;
+        uint32_t member_count;
+        uint32_t param_count;
+        uint32_t name_count;
+        uint32_t string_size;
+} PchHeader;
+
+typedef struct {
+        uint8_t kind;
+        uint8_t is_builtin; // One of ty_void, ty_int, ...
+        int32_t size;
+        int32_t align;
+        int32_t base; // Index of the base type, -1 if none
+        int32_t array_len;
+        int32_t members; // Index of the first member
+        int32_t member_count;
+        int32_t return_type;
+        int32_t params; // Index of the first parameter
+        int32_t param_count;
+} PchType;
+
+typedef struct {
+        int32_t name; // Offset into the string table
+        int32_t type;
+        int32_t offset;
+} PchMember;
+
+typedef struct {
+        int32_t type;
+} PchParam;
+
+enum {
+        PCH_VAR,
+        PCH_TYPEDEF,
+        PCH_ENUM_CONST,
+        PCH_TAG,
+};
+
+typedef struct {
+        int32_t name;
+        uint8_t kind;
+        uint8_t is_function;
+        uint8_t is_static;
+        int32_t type;
+        int32_t enum_val;
+} PchName;
+
+// Growable array of records being written
+typedef struct {
+        char *data;
+        int len; // Number of records
+        int capacity;
+        int size; // Record size
+} RecordVec;
+
+static RecordVec types = {.size = sizeof(PchType)};
+static RecordVec members = {.size = sizeof(PchMember)};
+static RecordVec params = {.size = sizeof(PchParam)};
+static RecordVec names = {.size = sizeof(PchName)};
+static RecordVec strings = {.size = 1};
+
+// Open-addressing map from Type * to record index
+static Type **type_keys;
+static int *type_ids;
+static int type_capacity;
+
+static int push_record(RecordVec *vec, int count) {
+        if (vec->len + count > vec->capacity) {
+                while (vec->len + count > vec->capacity)
+                        vec->capacity = vec->capacity ? vec->capacity * 2 : 256;
+                vec->data = realloc(vec->data, (size_t)vec->size * vec->capacity);
+                if (!vec->data)
+                        error("not enough memory in system to write precompiled header");
+        }
+        memset(vec->data + (size_t)vec->size * vec->len, 0, (size_t)vec->size * count);
+        vec->len += count;
+        return vec->len - count;
+}
+
+#define RECORD(vec, type, i) ((type *)(vec).data + (i))
+
+static int add_string(char *s) {
+        int len = strlen(s) + 1;
+        int offset = push_record(&strings, len);
+        memcpy(strings.data + offset, s, len);
+        return offset;
+}
+
+static int *type_slot(Type *type) {
+        if (!type_capacity) {
+                type_capacity = 1024;
+                type_keys = calloc(type_capacity, sizeof(Type *));
+                type_ids = calloc(type_capacity, sizeof(int));
+        }
+
+        // Keep the load factor under 1/2
+        if (types.len * 2 >= type_capacity) {
+                Type **old_keys = type_keys;
+                int *old_ids = type_ids;
+                int old_capacity = type_capacity;
+                type_capacity *= 2;
+                type_keys = calloc(type_capacity, sizeof(Type *));
+                type_ids = calloc(type_capacity, sizeof(int));
+                for (int i = 0; i < old_capacity; i++)
+                        if (old_keys[i])
+                                *type_slot(old_keys[i]) = old_ids[i];
+                free(old_keys);
+                free(old_ids);
+        }
+
+        int i = ((uintptr_t)type >> 4) & (type_capacity - 1);
+        while (type_keys[i] && type_keys[i] != type)
+                i = (i + 1) & (type_capacity - 1);
+        if (!type_keys[i]) {
+                type_keys[i] = type;
+                type_ids[i] = -1;
+        }
+        return &type_ids[i];
+}
+
+static bool is_builtin(Type *type) {
+        return type == ty_void || type == ty_bool || type == ty_char ||
+                type == ty_short || type == ty_int || type == ty_long;
+}
+
+// Returns the record index of `type`, writing it and the types it
+// refers to first if needed
+static int type_id(Type *type) {
+        if (!type)
+                return -1;
+
+        int *slot = type_slot(type);
+        if (*slot >= 0)
+                return *slot;
+
+        // The base of a pointer or an array has to come first
+        int base = -1;
+        if (type->kind == TY_PTR || type->kind == TY_ARRAY)
+                base = type_id(type->base);
+
+        // Structs and functions get their index before their members and
+        // parameters are written, so they can refer to themselves
+        int id = push_record(&types, 1);
+        *type_slot(type) = id;
+
+        PchType *rec = RECORD(types, PchType, id);
+        rec->kind = type->kind;
+        rec->is_builtin = is_builtin(type);
+        rec->size = type->size;
+        rec->align = type->align;
+        rec->base = base;
+        rec->array_len = type->array_len;
+        rec->return_type = -1;
+
+        if (type->kind == TY_STRUCT || type->kind == TY_UNION) {
+                int count = 0;
+                for (Member *m = type->members; m; m = m->next)
+                        count++;
+                int first = push_record(&members, count);
+                int i = first;
+                for (Member *m = type->members; m; m = m->next, i++) {
+                        int name = add_string(m->name);
+                        int member_type = type_id(m->type);
+                        PchMember *member = RECORD(members, PchMember, i);
+                        member->name = name;
+                        member->type = member_type;
+                        member->offset = m->offset;
+                }
+                rec = RECORD(types, PchType, id);
+                rec->members = first;
+                rec->member_count = count;
+        }
+
+        if (type->kind == TY_FUNC) {
+                int count = 0;
+                for (Param *p = type->params; p; p = p->next)
+                        count++;
+                int first = push_record(&params, count);
+                int i = first;
+                for (Param *p = type->params; p; p = p->next, i++) {
+                        int param_type = type_id(p->type);
+                        RECORD(params, PchParam, i)->type = param_type;
+                }
+                int return_type = type_id(type->return_type);
+                rec = RECORD(types, PchType, id);
+                rec->return_type = return_type;
+                rec->params = first;
+                rec->param_count = count;
+        }
+        return id;
+}
+
+// Saves the file-scope declarations parsed so far to `path`
+void write_pch(char *path) {
+        int count;
+        GlobalName *globals = global_names(&count);
+
+        for (int i = 0; i < count; i++) {
+                GlobalName *g = &globals[i];
+                if (g->var && (!g->var->is_function || g->var->is_definition))
+                        error("%s: a precompiled header can only declare functions and types", g->name);
+
+                int id = push_record(&names, 1);
+                int name = add_string(g->name);
+                int type = g->var ? type_id(g->var->type) :
+                        g->type_def ? type_id(g->type_def) :
+                        g->enum_type ? type_id(g->enum_type) : type_id(g->tag);
+
+                PchName *rec = RECORD(names, PchName, id);
+                rec->name = name;
+                rec->type = type;
+                rec->enum_val = g->enum_val;
+                rec->kind = g->var ? PCH_VAR : g->type_def ? PCH_TYPEDEF :
+                        g->enum_type ? PCH_ENUM_CONST : PCH_TAG;
+                if (g->var) {
+                        rec->is_function = true;
+                        rec->is_static = g->var->is_static;
+                }
+        }
+        free(globals);
+
+        PchHeader header = {PCH_MAGIC, types.len, members.len, params.len, names.len, strings.len};
+        FILE *out = fopen(path, "wb");
+        if (!out)
+                error("cannot open output file: %s: %s", path, strerror(errno));
+        fwrite(&header, sizeof(header), 1, out);
+        fwrite(types.data, types.size, types.len, out);
+        fwrite(members.data, members.size, members.len, out);
+        fwrite(params.data, params.size, params.len, out);
+        fwrite(names.data, names.size, names.len, out);
+        fwrite(strings.data, strings.size, strings.len, out);
+        if (fclose(out))
+                error("%s: %s", path, strerror(errno));
+}
+
+// State of the precompiled header being loaded. Every thread of a batch
+// compilation loads the header into its own global scope.
+static _Thread_local char *load_path;
+static _Thread_local PchHeader *load_header;
+static _Thread_local char *load_strings;
+static _Thread_local Type **loaded_types;
+
+static void check(bool ok) {
+        if (!ok)
+                error("%s: corrupt precompiled header", load_path);
+}
+
+static Type *loaded_type(int i) {
+        check(i >= 0 && i < load_header->type_count);
+        return loaded_types[i];
+}
+
+static char *loaded_string(int i) {
+        check(i >= 0 && i < load_header->string_size);
+        return intern(load_strings + i, strnlen(load_strings + i, load_header->string_size - i));
+}
+
+static Type *builtin_type(int kind) {
+        switch (kind) {
+                case TY_VOID: return ty_void;
+                case TY_BOOL: return ty_bool;
+                case TY_CHAR: return ty_char;
+                case TY_SHORT: return ty_short;
+                case TY_INT: return ty_int;
+                case TY_LONG: return ty_long;
+        }
+        return NULL;
+}
+
+// Declares the names saved in the precompiled header `path`
+void load_pch(char *path) {
+        int fd = open(path, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st))
+                error("cannot open %s: %s", path, strerror(errno));
+
+        size_t size = st.st_size;
+        if (size < sizeof(PchHeader))
+                error("%s: not a precompiled header", path);
+        char *buf = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (buf == MAP_FAILED)
+                error("cannot map %s: %s", path, strerror(errno));
+
+        PchHeader *header = (PchHeader *)buf;
+        if (memcmp(header->magic, PCH_MAGIC, sizeof(header->magic)))
+                error("%s: not a precompiled header", path);
+
+        PchType *type_recs = (PchType *)(header + 1);
+        PchMember *member_recs = (PchMember *)(type_recs + header->type_count);
+        PchParam *param_recs = (PchParam *)(member_recs + header->member_count);
+        PchName *name_recs = (PchName *)(param_recs + header->param_count);
+        load_path = path;
+        load_header = header;
+        load_strings = (char *)(name_recs + header->name_count);
+        check(load_strings + header->string_size == buf + size);
+
+        // Build the types. Bases come before the types derived from them,
+        // and structs and functions are filled in once all types exist.
+        Type **types = calloc(header->type_count + 1, sizeof(Type *));
+        loaded_types = types;
+        for (int i = 0; i < header->type_count; i++) {
+                PchType *rec = &type_recs[i];
+                Type *type;
+                if (rec->is_builtin) {
+                        type = builtin_type(rec->kind);
+                        check(type);
+                } else if (rec->kind == TY_PTR || rec->kind == TY_ARRAY) {
+                        check(rec->base < i);
+                        type = rec->kind == TY_PTR ? pointer_to(loaded_type(rec->base)) :
+                                array_of(loaded_type(rec->base), rec->array_len);
+                } else if (rec->kind == TY_STRUCT || rec->kind == TY_UNION) {
+                        type = struct_type();
+                        type->kind = rec->kind;
+                        type->size = rec->size;
+                        type->align = rec->align;
+                } else if (rec->kind == TY_ENUM) {
+                        type = enum_type();
+                } else {
+                        check(rec->kind == TY_FUNC);
+                        type = func_type(NULL);
+                }
+                types[i] = type;
+        }
+
+        for (int i = 0; i < header->type_count; i++) {
+                PchType *rec = &type_recs[i];
+                Type *type = types[i];
+
+                if (!rec->is_builtin && (rec->kind == TY_STRUCT || rec->kind == TY_UNION)) {
+                        check(rec->members >= 0 && rec->member_count >= 0 &&
+                                        rec->members + rec->member_count <= header->member_count);
+                        Member **cur = &type->members;
+                        for (int j = 0; j < rec->member_count; j++) {
+                                PchMember *m = &member_recs[rec->members + j];
+                                Member *member = arena_alloc(&type_arena, sizeof(Member));
+                                member->name = loaded_string(m->name);
+                                member->type = loaded_type(m->type);
+                                member->offset = m->offset;
+                                *cur = member;
+                                cur = &member->next;
+                        }
+                }
+
+                if (rec->kind == TY_FUNC) {
+                        check(rec->params >= 0 && rec->param_count >= 0 &&
+                                        rec->params + rec->param_count <= header->param_count);
+                        type->return_type = loaded_type(rec->return_type);
+                        Param **cur = &type->params;
+                        for (int j = 0; j < rec->param_count; j++) {
+                                Param *param = arena_alloc(&type_arena, sizeof(Param));
+                                param->type = loaded_type(param_recs[rec->params + j].type);
+                                *cur = param;
+                                cur = &param->next;
+                        }
+                }
+        }
+
+        for (int i = 0; i < header->name_count; i++) {
+                PchName *rec = &name_recs[i];
+                GlobalName name = {loaded_string(rec->name)};
+                Type *type = loaded_type(rec->type);
+
+                switch (rec->kind) {
+                        case PCH_VAR: {
+                                Obj *var = arena_alloc(&symbol_arena, sizeof(Obj));
+                                var->type = type;
+                                var->is_function = rec->is_function;
+                                var->is_static = rec->is_static;
+                                name.var = var;
+                                break;
+                        }
+                        case PCH_TYPEDEF:
+                                name.type_def = type;
+                                break;
+                        case PCH_ENUM_CONST:
+                                name.enum_type = type;
+                                name.enum_val = rec->enum_val;
+                                break;
+                        case PCH_TAG:
+                                name.tag = type;
+                                break;
+                        default:
+                                check(false);
+                }
+                define_global_name(&name);
+        }
+
+        free(types);
+        munmap(buf, size);
+}
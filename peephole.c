@@ -0,0 +1,383 @@
+#include "token.h"
+
+// The code generator writes the assembly of a function into an
+// AsmBuffer first, where the peephole optimizer can rewrite it before it
+// goes out. The patterns are those of the stack machine code of -O0;
+// the -O1 code generator produces few of them. Every pattern looks at a
+// handful of neighbouring lines and relies on one more property of the
+// generated code: a value a conditional jump tests is not read after
+// the jump.
+
+#define DELETED (-1)
+
+// Appends formatted text to the buffer and returns where it starts
+static long append_text(AsmBuffer *buf, char *fmt, va_list ap) {
+        long start = buf->text.len;
+        out_vformat(&buf->text, fmt, ap);
+        out_putc(&buf->text, '\0');
+        return start;
+}
+
+void asm_vprintf(AsmBuffer *buf, char *fmt, va_list ap) {
+        if (buf->count == buf->lines_cap) {
+                buf->lines_cap = buf->lines_cap ? buf->lines_cap * 2 : 256;
+                buf->lines = realloc(buf->lines, sizeof(long) * buf->lines_cap);
+        }
+        buf->lines[buf->count++] = append_text(buf, fmt, ap);
+}
+
+static char *line_at(AsmBuffer *buf, int i) {
+        return buf->lines[i] == DELETED ? NULL : buf->text.buf + buf->lines[i];
+}
+
+static void replace_line(AsmBuffer *buf, int i, char *fmt, ...) {
+        va_list ap;
+        va_start(ap, fmt);
+        buf->lines[i] = append_text(buf, fmt, ap);
+        va_end(ap);
+}
+
+// Writes the buffered lines to `out` and empties the buffer
+void asm_flush(AsmBuffer *buf, Output *out) {
+        for (int i = 0; i < buf->count; i++) {
+                if (buf->lines[i] != DELETED) {
+                        char *line = buf->text.buf + buf->lines[i];
+                        out_write(out, line, strlen(line));
+                        out_putc(out, '\n');
+                }
+        }
+        buf->text.len = 0;
+        buf->count = 0;
+}
+
+void asm_free(AsmBuffer *buf) {
+        free(buf->text.buf);
+        free(buf->lines);
+        *buf = (AsmBuffer){.text.fd = -1};
+}
+
+typedef enum {
+        PH_PUSH_POP, // push %rax ... pop %reg
+        PH_CALL_SETUP, // mov $0, %rax before a call
+        PH_SETCC_BRANCH, // setcc, movzb and cmp $0 before a je or jne
+        PH_SIGN_EXTEND, // movsxd of a value that is sign-extended already
+        PH_JUMP_NEXT, // Jump to the label right after it
+        PH_RULES,
+} Rule;
+
+static char *rule_names[] = {"push-pop", "call-setup", "setcc-branch", "sign-extend", "jump-next"};
+
+static atomic_long applied[PH_RULES];
+static atomic_long lines_in;
+static atomic_long lines_out;
+
+// One line taken apart. Operands are split at the last comma that is
+// not in parentheses.
+typedef struct {
+        char op[16];
+        char *arg1;
+        char *arg2; // NULL if there is a single operand
+        char buf[128];
+} Insn;
+
+static bool is_label(char *line) {
+        size_t len = strlen(line);
+        return len && line[len - 1] == ':';
+}
+
+static bool is_directive(char *line) {
+        while (*line == ' ')
+                line++;
+        return *line == '.' && !is_label(line);
+}
+
+static bool is_loc(char *line) {
+        while (*line == ' ')
+                line++;
+        return !strncmp(line, ".loc ", 5);
+}
+
+// Returns false for labels and directives
+static bool parse_line(char *line, Insn *insn) {
+        if (!line || is_label(line) || is_directive(line))
+                return false;
+        while (*line == ' ')
+                line++;
+
+        int n = 0;
+        while (isalnum(*line) && n < (int)sizeof(insn->op) - 1)
+                insn->op[n++] = *line++;
+        insn->op[n] = '\0';
+        while (*line == ' ')
+                line++;
+
+        snprintf(insn->buf, sizeof(insn->buf), "%s", line);
+        insn->arg1 = *insn->buf ? insn->buf : NULL;
+        insn->arg2 = NULL;
+        char *comma = NULL;
+        int parens = 0;
+        for (char *p = insn->buf; *p; p++) {
+                if (*p == '(')
+                        parens++;
+                else if (*p == ')')
+                        parens--;
+                else if (*p == ',' && !parens)
+                        comma = p;
+        }
+        if (comma) {
+                *comma = '\0';
+                insn->arg2 = comma + 1;
+                while (*insn->arg2 == ' ')
+                        insn->arg2++;
+        }
+        return true;
+}
+
+static bool is_op(Insn *insn, char *op) {
+        return !strcmp(insn->op, op);
+}
+
+static bool is_arg(char *arg, char *name) {
+        return arg && !strcmp(arg, name);
+}
+
+// The next line that is not deleted or a .loc directive, or -1
+static int next_line(AsmBuffer *buf, int i) {
+        for (i++; i < buf->count; i++)
+                if (buf->lines[i] != DELETED && !is_loc(line_at(buf, i)))
+                        return i;
+        return -1;
+}
+
+static bool is_jump(Insn *insn) {
+        return insn->op[0] == 'j';
+}
+
+// Every name of each general purpose register
+static char *registers[][4] = {
+        {"%rax", "%eax", "%ax", "%al"}, {"%rcx", "%ecx", "%cx", "%cl"},
+        {"%rdx", "%edx", "%dx", "%dl"}, {"%rbx", "%ebx", "%bx", "%bl"},
+        {"%rsi", "%esi", "%si", "%sil"}, {"%rdi", "%edi", "%di", "%dil"},
+        {"%rbp", "%ebp", "%bp", "%bpl"}, {"%rsp", "%esp", "%sp", "%spl"},
+        {"%r8", "%r8d", "%r8w", "%r8b"}, {"%r9", "%r9d", "%r9w", "%r9b"},
+        {"%r10", "%r10d", "%r10w", "%r10b"}, {"%r11", "%r11d", "%r11w", "%r11b"},
+        {"%r12", "%r12d", "%r12w", "%r12b"}, {"%r13", "%r13d", "%r13w", "%r13b"},
+        {"%r14", "%r14d", "%r14w", "%r14b"}, {"%r15", "%r15d", "%r15w", "%r15b"},
+};
+
+#define REGISTER_COUNT (int)(sizeof(registers) / sizeof(*registers))
+
+// Index of the 64-bit register `name`, or -1
+static int reg64_index(char *name) {
+        for (int i = 0; i < REGISTER_COUNT; i++)
+                if (is_arg(name, registers[i][0]))
+                        return i;
+        return -1;
+}
+
+static bool mentions_name(char *arg, char *name) {
+        if (!arg)
+                return false;
+        size_t len = strlen(name);
+        for (char *p = strstr(arg, name); p; p = strstr(p + 1, name))
+                if (!isalnum(p[len]))
+                        return true;
+        return false;
+}
+
+// Whether `insn` may read or write register `reg`
+static bool touches(Insn *insn, int reg) {
+        for (int i = 0; i < 4; i++)
+                if (mentions_name(insn->arg1, registers[reg][i]) || mentions_name(insn->arg2, registers[reg][i]))
+                        return true;
+
+        // Division uses %rdx implicitly
+        bool divides = is_op(insn, "cqo") || is_op(insn, "cdq") || !strncmp(insn->op, "idiv", 4);
+        return divides && !strcmp(registers[reg][0], "%rdx");
+}
+
+// push %rax followed by pop %reg moves %rax to %reg, as long as nothing
+// in between uses the stack or %reg
+static bool push_pop(AsmBuffer *buf, int i, Insn *push) {
+        if (!is_op(push, "push") || !is_arg(push->arg1, "%rax"))
+                return false;
+
+        int pop = -1;
+        Insn insn;
+        for (int j = next_line(buf, i), steps = 0; j >= 0 && steps < 32; j = next_line(buf, j), steps++) {
+                if (!parse_line(line_at(buf, j), &insn))
+                        return false;
+                if (is_op(&insn, "pop")) {
+                        pop = j;
+                        break;
+                }
+                if (is_op(&insn, "push") || is_op(&insn, "call") || is_op(&insn, "ret") || is_jump(&insn))
+                        return false;
+        }
+        if (pop < 0)
+                return false;
+
+        int reg = reg64_index(insn.arg1);
+        if (reg < 0)
+                return false;
+        if (reg == 0) {
+                // push %rax and pop %rax with nothing in between
+                if (next_line(buf, i) != pop)
+                        return false;
+                buf->lines[i] = DELETED;
+                buf->lines[pop] = DELETED;
+                return true;
+        }
+
+        for (int j = next_line(buf, i); j != pop; j = next_line(buf, j)) {
+                Insn between;
+                parse_line(line_at(buf, j), &between);
+                if (touches(&between, reg) || touches(&between, 7))
+                        return false;
+        }
+        replace_line(buf, i, "  mov %%rax, %s", registers[reg][0]);
+        buf->lines[pop] = DELETED;
+        return true;
+}
+
+// %al only has to be 0 for a variadic callee, and xor sets it with a
+// shorter instruction
+static bool call_setup(AsmBuffer *buf, int i, Insn *mov) {
+        if (!is_op(mov, "mov") || !is_arg(mov->arg1, "$0") ||
+                        (!is_arg(mov->arg2, "%rax") && !is_arg(mov->arg2, "%eax")))
+                return false;
+        Insn call;
+        if (!parse_line(line_at(buf, next_line(buf, i)), &call) || !is_op(&call, "call"))
+                return false;
+        replace_line(buf, i, "  xor %%eax, %%eax");
+        return true;
+}
+
+static char *negate_cc(char *cc) {
+        static char *pairs[][2] = {
+                {"e", "ne"}, {"ne", "e"}, {"l", "ge"}, {"ge", "l"}, {"le", "g"}, {"g", "le"},
+                {"b", "ae"}, {"ae", "b"}, {"be", "a"}, {"a", "be"},
+        };
+        for (int i = 0; i < (int)(sizeof(pairs) / sizeof(*pairs)); i++)
+                if (!strcmp(cc, pairs[i][0]))
+                        return pairs[i][1];
+        return NULL;
+}
+
+static bool is_rax(char *arg) {
+        return is_arg(arg, "%rax") || is_arg(arg, "%eax");
+}
+
+// setcc %al; movzb %al, %rax; cmp $0, %rax; je L is jncc L
+static bool setcc_branch(AsmBuffer *buf, int i, Insn *set) {
+        if (strncmp(set->op, "set", 3) || !is_arg(set->arg1, "%al") || !negate_cc(set->op + 3))
+                return false;
+
+        int j = next_line(buf, i);
+        Insn movzb;
+        if (!parse_line(line_at(buf, j), &movzb) || strncmp(movzb.op, "movz", 4) ||
+                        !is_arg(movzb.arg1, "%al") || !is_rax(movzb.arg2))
+                return false;
+
+        int k = next_line(buf, j);
+        Insn cmp;
+        if (!parse_line(line_at(buf, k), &cmp) || !is_op(&cmp, "cmp") || !is_arg(cmp.arg1, "$0") || !is_rax(cmp.arg2))
+                return false;
+
+        int l = next_line(buf, k);
+        Insn jump;
+        if (!parse_line(line_at(buf, l), &jump) || (!is_op(&jump, "je") && !is_op(&jump, "jne")))
+                return false;
+
+        char *cc = set->op + 3;
+        replace_line(buf, l, "  j%s %s", is_op(&jump, "je") ? negate_cc(cc) : cc, jump.arg1);
+        buf->lines[i] = buf->lines[j] = buf->lines[k] = DELETED;
+        return true;
+}
+
+static bool is_sign_extension(Insn *insn) {
+        return is_op(insn, "movsxd") || is_op(insn, "movslq");
+}
+
+// A movsxd %eax, %rax right after %rax got a sign-extended value
+static bool sign_extend(AsmBuffer *buf, int i, Insn *def) {
+        int reg = reg64_index(def->arg2);
+        if (reg < 0)
+                return false;
+        bool extended = is_sign_extension(def);
+        if (is_op(def, "mov") && def->arg1[0] == '$') {
+                char *end;
+                long val = strtol(def->arg1 + 1, &end, 10);
+                extended = !*end && val == (int32_t)val;
+        }
+        if (!extended)
+                return false;
+
+        int j = next_line(buf, i);
+        Insn ext;
+        if (!parse_line(line_at(buf, j), &ext) || !is_sign_extension(&ext) ||
+                        !is_arg(ext.arg1, registers[reg][1]) || !is_arg(ext.arg2, registers[reg][0]))
+                return false;
+        buf->lines[j] = DELETED;
+        return true;
+}
+
+static bool jump_next(AsmBuffer *buf, int i, Insn *jump) {
+        if (!is_jump(jump) || !jump->arg1 || jump->arg2)
+                return false;
+        for (int j = next_line(buf, i); j >= 0; j = next_line(buf, j)) {
+                char *line = line_at(buf, j);
+                if (!is_label(line))
+                        return false;
+                size_t len = strlen(jump->arg1);
+                if (!strncmp(line, jump->arg1, len) && line[len] == ':') {
+                        buf->lines[i] = DELETED;
+                        return true;
+                }
+        }
+        return false;
+}
+
+// Rewrites the lines of one function
+void peephole(AsmBuffer *buf) {
+        long counts[PH_RULES] = {};
+        for (bool changed = true; changed;) {
+                changed = false;
+                for (int i = 0; i < buf->count; i++) {
+                        Insn insn;
+                        if (buf->lines[i] == DELETED || !parse_line(line_at(buf, i), &insn))
+                                continue;
+
+                        Rule rule;
+                        if (push_pop(buf, i, &insn))
+                                rule = PH_PUSH_POP;
+                        else if (call_setup(buf, i, &insn))
+                                rule = PH_CALL_SETUP;
+                        else if (setcc_branch(buf, i, &insn))
+                                rule = PH_SETCC_BRANCH;
+                        else if (sign_extend(buf, i, &insn))
+                                rule = PH_SIGN_EXTEND;
+                        else if (jump_next(buf, i, &insn))
+                                rule = PH_JUMP_NEXT;
+                        else
+                                continue;
+                        counts[rule]++;
+                        changed = true;
+                }
+        }
+
+        long out = 0;
+        for (int i = 0; i < buf->count; i++)
+                if (buf->lines[i] != DELETED)
+                        out++;
+        atomic_fetch_add(&lines_in, buf->count);
+        atomic_fetch_add(&lines_out, out);
+        for (int i = 0; i < PH_RULES; i++)
+                atomic_fetch_add(&applied[i], counts[i]);
+}
+
+void print_peephole_stats(FILE *out) {
+        for (int i = 0; i < PH_RULES; i++)
+                fprintf(out, "%-13s %10ld\n", rule_names[i], atomic_load(&applied[i]));
+        fprintf(out, "%-13s %10ld in %10ld out\n", "lines", atomic_load(&lines_in), atomic_load(&lines_out));
+}
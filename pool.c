@@ -0,0 +1,127 @@
+#include "token.h"
+#include <pthread.h>
+#include <sched.h>
+
+// Work-stealing thread pool for batch compilation. Jobs are numbered
+// 0..n-1 and handed out to the workers in contiguous runs up front.
+// Every worker takes jobs from the back of its own deque; once that is
+// empty it steals from the front of the other workers' deques, so a
+// worker that got cheap files helps out the ones that got expensive
+// files. Jobs never create new jobs, which makes a worker that finds
+// every deque empty free to stop.
+
+// Parsing recurses deeply on long expressions, so workers get as much
+// stack as the main thread usually has
+#define WORKER_STACK_SIZE (8 * 1024 * 1024)
+
+typedef struct {
+        pthread_mutex_t lock;
+        int *jobs;
+        int front; // Next job to steal
+        int back; // One past the next job the owner takes
+} Deque;
+
+static Deque *deques;
+static int worker_count;
+static void (*run_job)(int job);
+
+static pthread_t start_thread(void *(*fn)(void *), void *arg) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, WORKER_STACK_SIZE);
+        pthread_t thread;
+        int err = pthread_create(&thread, &attr, fn, arg);
+        if (err)
+                error("cannot start thread: %s", strerror(err));
+        pthread_attr_destroy(&attr);
+        return thread;
+}
+
+// Takes a job from the back of `deque`, or from its front when stealing
+static bool take(Deque *deque, bool steal, int *job) {
+        pthread_mutex_lock(&deque->lock);
+        bool found = deque->front < deque->back;
+        if (found)
+                *job = steal ? deque->jobs[deque->front++] : deque->jobs[--deque->back];
+        pthread_mutex_unlock(&deque->lock);
+        return found;
+}
+
+static bool steal(int self, int *job) {
+        for (int i = 1; i < worker_count; i++)
+                if (take(&deques[(self + i) % worker_count], true, job))
+                        return true;
+        return false;
+}
+
+static void *worker(void *arg) {
+        int self = (intptr_t)arg;
+        int job;
+        while (take(&deques[self], false, &job) || steal(self, &job))
+                run_job(job);
+        return NULL;
+}
+
+// Calls `run` once for every job in 0..job_count-1 on `workers` threads
+void run_jobs(int job_count, int workers, void (*run)(int job)) {
+        if (workers > job_count)
+                workers = job_count;
+        if (workers <= 1) {
+                for (int i = 0; i < job_count; i++)
+                        run(i);
+                return;
+        }
+
+        worker_count = workers;
+        run_job = run;
+        deques = calloc(workers, sizeof(Deque));
+        int *jobs = calloc(job_count, sizeof(int));
+        for (int i = 0; i < job_count; i++)
+                jobs[i] = i;
+        for (int i = 0; i < workers; i++) {
+                pthread_mutex_init(&deques[i].lock, NULL);
+                deques[i].jobs = jobs;
+                deques[i].front = (int64_t)job_count * i / workers;
+                deques[i].back = (int64_t)job_count * (i + 1) / workers;
+        }
+
+        pthread_t *threads = calloc(workers, sizeof(pthread_t));
+        for (int i = 0; i < workers; i++)
+                threads[i] = start_thread(worker, (void *)(intptr_t)i);
+        for (int i = 0; i < workers; i++)
+                pthread_join(threads[i], NULL);
+
+        for (int i = 0; i < workers; i++)
+                pthread_mutex_destroy(&deques[i].lock);
+        free(threads);
+        free(jobs);
+        free(deques);
+}
+
+// Runs `consumer` on a new thread while `producer` runs on the calling
+// thread and returns once both are done
+void run_pipeline(void (*producer)(void *arg), void *(*consumer)(void *arg), void *arg) {
+        pthread_t thread = start_thread(consumer, arg);
+        producer(arg);
+        pthread_join(thread, NULL);
+}
+
+// The producer only ever writes `tail` and the consumer only `head`, so
+// neither needs a lock. A full or empty queue makes the waiting side
+// yield its time slice until the other side catches up.
+void queue_push(Queue *queue, void *item) {
+        size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+        while (tail - atomic_load_explicit(&queue->head, memory_order_acquire) == QUEUE_SIZE)
+                sched_yield();
+        queue->items[tail % QUEUE_SIZE] = item;
+        atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+}
+
+void *queue_pop(Queue *queue) {
+        size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+        while (atomic_load_explicit(&queue->tail, memory_order_acquire) == head)
+                sched_yield();
+        void *item = queue->items[head % QUEUE_SIZE];
+        atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+        return item;
+}
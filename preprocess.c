@@ -0,0 +1,1083 @@
+#include "token.h"
+#include <pthread.h>
+
+// Preprocessor. It runs between the lexer and the parser and turns the
+// token array of the input file into a new token array with directives
+// executed and macros expanded.
+//
+// Tokens are read from a stack of sources: the token arrays of the files
+// being included and the expansions of the macros being expanded. A
+// macro is disabled while its expansion is on the stack, and its name
+// read in the meantime is marked TF_NOEXPAND so that it is not expanded
+// later either.
+//
+// Every header is lexed only once per process and its token array is
+// cached, for all threads and translation units. A header that has
+// "#pragma once", or whose contents are all inside a classic include
+// guard, is not read again once it has been included and its guard
+// macro is defined.
+
+#define MAX_INCLUDE_DEPTH 200
+
+typedef struct Macro {
+        char *name; // Interned
+        bool is_function;
+        bool is_variadic; // The last parameter is __VA_ARGS__
+        bool is_active; // Being expanded
+        bool is_deleted; // #undef'ed
+        bool has_paste; // Replacement list contains "##"
+        char **params;
+        int param_count;
+        Token *body; // Replacement list, points into the defining file's tokens
+        int body_len;
+} Macro;
+
+// A file that has been included. Headers in the process-wide cache
+// are copied into the list of the unit that includes them, which
+// tracks "#pragma once" for that unit.
+typedef struct Header Header;
+struct Header {
+        Header *next;
+        char *path; // Interned
+        Token *tokens;
+        Token *eof;
+        char *guard; // Include guard macro, NULL if there is none
+        bool once; // Has "#pragma once"
+};
+
+typedef struct {
+        Token *cur;
+        Token *end;
+        Token eof; // Returned at the end of the main file and of barriers
+        Header *header; // Set if this is a file
+        Macro *macro; // Set if this is a macro expansion
+        Token *owned; // Buffer to free once the source is done
+        int cond_depth; // Number of open conditionals when the file was entered
+        bool barrier; // Ends with `eof` instead of going on with the source below
+} Source;
+
+// Growable token array for macro arguments and expansions
+typedef struct {
+        Token *data;
+        int len;
+        int capacity;
+} TokenVec;
+
+// #if, #ifdef or #ifndef that has not been closed by #endif yet
+typedef struct {
+        enum { IN_THEN, IN_ELIF, IN_ELSE } ctx;
+        bool included; // One of the branches has been taken
+        Token *token;
+} CondIncl;
+
+// Everything but the include paths is per thread, see reset_preprocessor()
+static _Thread_local Source *sources;
+static _Thread_local int source_count;
+static _Thread_local int source_capacity;
+
+static _Thread_local CondIncl *conds;
+static _Thread_local int cond_count;
+static _Thread_local int cond_capacity;
+
+static _Thread_local Header *headers;
+
+// Headers lexed so far by any thread, in an open-addressing table keyed
+// by interned path. Entries are added under cache_lock and never change.
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static Header **header_cache;
+static int header_cache_count;
+static int header_cache_capacity;
+
+// Open-addressing table of macros keyed by interned name
+static _Thread_local Macro **macros;
+static _Thread_local int macro_count;
+static _Thread_local int macro_capacity;
+
+// Set from the command line before any thread starts
+static char **include_paths;
+static int include_path_count;
+
+// Output token array
+static _Thread_local Token *out;
+static _Thread_local int out_count;
+static _Thread_local int out_capacity;
+
+// "0" and "1" for the result of defined()
+static _Thread_local Token *numbers[2];
+
+static _Thread_local char *name_defined;
+static _Thread_local char *name_va_args;
+
+void add_include_path(char *dir) {
+        include_paths = realloc(include_paths, sizeof(char *) * (include_path_count + 1));
+        include_paths[include_path_count++] = dir;
+}
+
+static void vec_push(TokenVec *vec, Token *token) {
+        if (vec->len == vec->capacity) {
+                vec->capacity = vec->capacity ? vec->capacity * 2 : 16;
+                vec->data = realloc(vec->data, sizeof(Token) * vec->capacity);
+                if (!vec->data)
+                        error("not enough memory in system to expand macros");
+        }
+        vec->data[vec->len++] = *token;
+}
+
+// Tokens of cached headers get the number their file has in the unit
+static void emit(Token *token) {
+        if (out_count == out_capacity) {
+                out_capacity = out_capacity ? out_capacity * 2 : 4096;
+                out = arena_resize_block(&token_arena, out, sizeof(Token) * out_capacity);
+        }
+        out[out_count] = *token;
+        out[out_count++].file_no = unit_file_no(token->file_no);
+}
+
+static char *ident_of(Token *token) {
+        if (token->token_type == T_IDENT || token->token_type == T_KEYWORD)
+                return token->ident;
+        return NULL;
+}
+
+// Returns true if `token` starts the directive `name`
+static bool is_directive(Token *token, char *name) {
+        if (token->id != '#' || !(token->flags & TF_BOL) || (token[1].flags & TF_BOL))
+                return false;
+        char *ident = ident_of(token + 1);
+        return ident && !strcmp(ident, name);
+}
+
+// Returns the first token of the next line
+static Token *skip_line(Token *token) {
+        while (token->token_type != T_EOF && !(token->flags & TF_BOL))
+                token++;
+        return token;
+}
+
+//
+// Macro table
+//
+
+static Macro **macro_slot(char *name) {
+        int i = ((uintptr_t)name >> 4) & (macro_capacity - 1);
+        while (macros[i] && macros[i]->name != name)
+                i = (i + 1) & (macro_capacity - 1);
+        return &macros[i];
+}
+
+static Macro *find_macro(char *name) {
+        if (!macro_capacity)
+                return NULL;
+        Macro *macro = *macro_slot(name);
+        return macro && !macro->is_deleted ? macro : NULL;
+}
+
+static void add_macro(Macro *macro) {
+        // Keep the load factor under 1/2
+        if ((macro_count + 1) * 2 > macro_capacity) {
+                Macro **old = macros;
+                int old_capacity = macro_capacity;
+                macro_capacity = macro_capacity ? macro_capacity * 2 : 256;
+                macros = calloc(macro_capacity, sizeof(Macro *));
+                for (int i = 0; i < old_capacity; i++)
+                        if (old[i])
+                                *macro_slot(old[i]->name) = old[i];
+                free(old);
+        }
+
+        Macro **slot = macro_slot(macro->name);
+        if (!*slot)
+                macro_count++;
+        *slot = macro;
+}
+
+//
+// Token sources
+//
+
+static Source *push_source(Token *cur, Token *end) {
+        if (source_count == source_capacity) {
+                source_capacity = source_capacity ? source_capacity * 2 : 64;
+                sources = realloc(sources, sizeof(Source) * source_capacity);
+        }
+        Source *src = &sources[source_count++];
+        *src = (Source){cur, end};
+        return src;
+}
+
+static void pop_source(void) {
+        Source *src = &sources[--source_count];
+        if (src->macro)
+                src->macro->is_active = false;
+        if (src->header && cond_count != src->cond_depth)
+                error_tok(conds[cond_count - 1].token, "unterminated conditional directive");
+        free(src->owned);
+}
+
+static void push_file(Header *header) {
+        Source *src = push_source(header->tokens, header->eof);
+        src->eof = *header->eof;
+        src->header = header;
+        src->cond_depth = cond_count;
+}
+
+// Returns the next token without expanding macros
+static Token next_token(void) {
+        for (;;) {
+                Source *src = &sources[source_count - 1];
+                if (src->cur < src->end)
+                        return *src->cur++;
+                if (src->barrier || source_count == 1)
+                        return src->eof;
+                pop_source();
+        }
+}
+
+// Returns the token next_token() would return next without consuming it
+static Token *peek_token(void) {
+        for (;;) {
+                Source *src = &sources[source_count - 1];
+                if (src->cur < src->end)
+                        return src->cur;
+                if (src->barrier || source_count == 1)
+                        return &src->eof;
+                pop_source();
+        }
+}
+
+//
+// Macro expansion
+//
+
+static Token expand_next(void);
+
+// Gives `token` the spacing flags of `from`, whose place it takes
+static void inherit_spacing(Token *token, Token *from) {
+        token->flags = (token->flags & TF_NOEXPAND) | (from->flags & (TF_BOL | TF_SPACE));
+}
+
+// Gives a token made up from `from` its file and line as well
+static void inherit_position(Token *token, Token *from) {
+        token->file_no = from->file_no;
+        token->line_num = from->line_num;
+        inherit_spacing(token, from);
+}
+
+// Lexes text made up by the preprocessor, which has to be a single token
+static Token new_token_from(char *text, Token *at) {
+        Token *tokens = tokenize_scratch(token_file(at)->display_name, text);
+        if (tokens[0].token_type == T_EOF || tokens[1].token_type != T_EOF)
+                error_tok(at, "'%s' is not a valid token", text);
+        Token token = tokens[0];
+        inherit_position(&token, at);
+        return token;
+}
+
+// Turns the tokens of a macro argument into a string literal token
+static Token stringize(TokenVec *arg, Token *hash) {
+        char *buf;
+        size_t buflen;
+        FILE *text = open_memstream(&buf, &buflen);
+
+        fputc('"', text);
+        for (int i = 0; i < arg->len; i++) {
+                Token *token = &arg->data[i];
+                if (i && (token->flags & TF_SPACE))
+                        fputc(' ', text);
+
+                // Only string and character literals get escaped
+                bool quoted = token->loc[0] == '"' || token->loc[0] == '\'';
+                for (int j = 0; j < token->len; j++) {
+                        if (quoted && (token->loc[j] == '"' || token->loc[j] == '\\'))
+                                fputc('\\', text);
+                        fputc(token->loc[j], text);
+                }
+        }
+        fputc('"', text);
+        fclose(text);
+
+        // The string takes the line of the argument it spells
+        Token token = new_token_from(arena_strndup(&token_arena, buf, buflen), hash);
+        if (arg->len) {
+                token.file_no = arg->data[0].file_no;
+                token.line_num = arg->data[0].line_num;
+        }
+        free(buf);
+        return token;
+}
+
+static Token paste(Token *left, Token *right) {
+        char *buf = format("%.*s%.*s", left->len, left->loc, right->len, right->loc);
+        Token token = new_token_from(arena_strndup(&token_arena, buf, strlen(buf)), left);
+        free(buf);
+        return token;
+}
+
+// Fully macro-expands `tokens` on their own
+static TokenVec expand_tokens(TokenVec *tokens, Token *at) {
+        Source *src = push_source(tokens->data, tokens->data + tokens->len);
+        src->barrier = true;
+        src->eof = *at;
+        src->eof.token_type = T_EOF;
+        src->eof.id = 0;
+
+        TokenVec vec = {};
+        for (;;) {
+                Token token = expand_next();
+                if (token.token_type == T_EOF)
+                        break;
+                vec_push(&vec, &token);
+        }
+        pop_source();
+        return vec;
+}
+
+static int param_index(Macro *macro, Token *token) {
+        char *name = ident_of(token);
+        if (name)
+                for (int i = 0; i < macro->param_count; i++)
+                        if (macro->params[i] == name)
+                                return i;
+        return -1;
+}
+
+// Reads the arguments of a call to a function-like macro up to and
+// including the closing parenthesis
+static TokenVec *read_args(Macro *macro, Token *name) {
+        int count = macro->param_count ? macro->param_count : 1;
+        TokenVec *args = calloc(count, sizeof(TokenVec));
+        int n = 0;
+        int depth = 0;
+
+        for (;;) {
+                Token token = next_token();
+                if (token.token_type == T_EOF)
+                        error_tok(name, "unterminated macro call");
+                if (depth == 0 && token.id == ')')
+                        break;
+
+                // The variadic parameter takes all the remaining arguments
+                if (depth == 0 && token.id == ',' && !(macro->is_variadic && n == count - 1)) {
+                        if (++n == count)
+                                error_tok(name, "too many arguments");
+                        continue;
+                }
+
+                if (token.id == '(')
+                        depth++;
+                else if (token.id == ')')
+                        depth--;
+                vec_push(&args[n], &token);
+        }
+
+        if (macro->param_count == 0 && args[0].len)
+                error_tok(name, "too many arguments");
+        if (n + 1 < count && !(macro->is_variadic && n + 2 == count))
+                error_tok(name, "too few arguments");
+        return args;
+}
+
+// Appends the replacement list of `macro` to `vec` with parameters
+// replaced by arguments and "#" and "##" applied
+static void subst(TokenVec *vec, Macro *macro, TokenVec *args) {
+        TokenVec *expanded = calloc(macro->param_count + 1, sizeof(TokenVec));
+        bool *is_expanded = calloc(macro->param_count + 1, sizeof(bool));
+
+        for (int i = 0; i < macro->body_len; i++) {
+                Token *token = &macro->body[i];
+                Token *next = i + 1 < macro->body_len ? token + 1 : NULL;
+
+                // "#" param
+                if (macro->is_function && token->id == '#') {
+                        int param = next ? param_index(macro, next) : -1;
+                        if (param < 0)
+                                error_tok(token, "'#' is not followed by a macro parameter");
+                        Token str = stringize(&args[param], token);
+                        vec_push(vec, &str);
+                        i++;
+                        continue;
+                }
+
+                // x ## y
+                if (token->id == TK_HASHHASH) {
+                        int param = param_index(macro, next);
+                        TokenVec *right = param >= 0 ? &args[param] : NULL;
+                        if (right && !right->len) {
+                                i++;
+                                continue;
+                        }
+
+                        Token *first = right ? &right->data[0] : next;
+                        if (vec->len)
+                                vec->data[vec->len - 1] = paste(&vec->data[vec->len - 1], first);
+                        else
+                                vec_push(vec, first);
+                        if (right)
+                                for (int j = 1; j < right->len; j++)
+                                        vec_push(vec, &right->data[j]);
+                        i++;
+                        continue;
+                }
+
+                int param = param_index(macro, token);
+                if (param < 0) {
+                        vec_push(vec, token);
+                        continue;
+                }
+
+                // An operand of "##" is not expanded. An empty left operand
+                // leaves the right operand alone.
+                if (next && next->id == TK_HASHHASH) {
+                        if (args[param].len == 0) {
+                                int right = param_index(macro, next + 1);
+                                if (right >= 0)
+                                        for (int j = 0; j < args[right].len; j++)
+                                                vec_push(vec, &args[right].data[j]);
+                                else
+                                        vec_push(vec, next + 1);
+                                i += 2;
+                                continue;
+                        }
+                        for (int j = 0; j < args[param].len; j++)
+                                vec_push(vec, &args[param].data[j]);
+                        continue;
+                }
+
+                if (!is_expanded[param]) {
+                        expanded[param] = expand_tokens(&args[param], token);
+                        is_expanded[param] = true;
+                }
+                for (int j = 0; j < expanded[param].len; j++) {
+                        vec_push(vec, &expanded[param].data[j]);
+                        if (j == 0)
+                                inherit_spacing(&vec->data[vec->len - 1], token);
+                }
+        }
+
+        for (int i = 0; i < macro->param_count; i++)
+                free(expanded[i].data);
+        free(expanded);
+        free(is_expanded);
+}
+
+// Pushes the expansion of `macro` named by `name`. Returns false if
+// `name` is not expanded after all because a function-like macro is
+// not followed by arguments.
+static bool expand_macro(Macro *macro, Token *name) {
+        TokenVec vec = {};
+
+        if (!macro->is_function) {
+                if (!macro->has_paste) {
+                        // The replacement list can be read in place
+                        Source *src = push_source(macro->body, macro->body + macro->body_len);
+                        src->macro = macro;
+                        macro->is_active = true;
+                        return true;
+                }
+                subst(&vec, macro, NULL);
+        } else {
+                if (peek_token()->id != '(')
+                        return false;
+                next_token();
+
+                TokenVec *args = read_args(macro, name);
+                subst(&vec, macro, args);
+                for (int i = 0; i < macro->param_count; i++)
+                        free(args[i].data);
+                free(args);
+        }
+
+        // The expansion takes the place of the name in the output
+        if (vec.len)
+                inherit_spacing(&vec.data[0], name);
+
+        Source *src = push_source(vec.data, vec.data + vec.len);
+        src->macro = macro;
+        src->owned = vec.data;
+        macro->is_active = true;
+        return true;
+}
+
+// Returns the next token with macros expanded
+static Token expand_next(void) {
+        for (;;) {
+                Token token = next_token();
+                char *name = ident_of(&token);
+                if (!name || (token.flags & TF_NOEXPAND))
+                        return token;
+
+                Macro *macro = find_macro(name);
+                if (!macro)
+                        return token;
+                if (macro->is_active) {
+                        token.flags |= TF_NOEXPAND;
+                        return token;
+                }
+                if (!expand_macro(macro, &token))
+                        return token;
+        }
+}
+
+//
+// #if expressions
+//
+
+static int64_t eval_expr(Token **rest, Token *token);
+
+static int binary_precedence(int id) {
+        switch (id) {
+                case '*': case '/': case '%': return 10;
+                case '+': case '-': return 9;
+                case '<': case '>': case TK_LE: case TK_GE: return 8;
+                case TK_EQ: case TK_NE: return 7;
+                case '&': return 6;
+                case '^': return 5;
+                case '|': return 4;
+                case TK_LOGAND: return 3;
+                case TK_LOGOR: return 2;
+        }
+        return 0;
+}
+
+static int64_t eval_unary(Token **rest, Token *token) {
+        switch (token->id) {
+                case '+': return eval_unary(rest, token + 1);
+                case '-': return -eval_unary(rest, token + 1);
+                case '!': return !eval_unary(rest, token + 1);
+                case '~': return ~eval_unary(rest, token + 1);
+                case '(': {
+                        int64_t val = eval_expr(&token, token + 1);
+                        *rest = skip(token, ')');
+                        return val;
+                }
+        }
+
+        if (token->token_type == T_NUM) {
+                *rest = token + 1;
+                return token_literal(token)->val;
+        }
+
+        // Identifiers left after macro expansion are 0
+        if (ident_of(token)) {
+                *rest = token + 1;
+                return 0;
+        }
+        error_tok(token, "expected an expression");
+        return 0;
+}
+
+static int64_t eval_binary(Token **rest, Token *token, int min_precedence) {
+        int64_t val = eval_unary(&token, token);
+
+        for (;;) {
+                int precedence = binary_precedence(token->id);
+                if (!precedence || precedence < min_precedence)
+                        break;
+
+                Token *op = token;
+                int64_t right = eval_binary(&token, token + 1, precedence + 1);
+                switch (op->id) {
+                        case '*': val *= right; break;
+                        case '/':
+                        case '%':
+                                if (right == 0)
+                                        error_tok(op, "division by zero");
+                                val = op->id == '/' ? val / right : val % right;
+                                break;
+                        case '+': val += right; break;
+                        case '-': val -= right; break;
+                        case '<': val = val < right; break;
+                        case '>': val = val > right; break;
+                        case TK_LE: val = val <= right; break;
+                        case TK_GE: val = val >= right; break;
+                        case TK_EQ: val = val == right; break;
+                        case TK_NE: val = val != right; break;
+                        case '&': val &= right; break;
+                        case '^': val ^= right; break;
+                        case '|': val |= right; break;
+                        case TK_LOGAND: val = val && right; break;
+                        case TK_LOGOR: val = val || right; break;
+                }
+        }
+        *rest = token;
+        return val;
+}
+
+static int64_t eval_expr(Token **rest, Token *token) {
+        int64_t cond = eval_binary(&token, token, 1);
+        if (token->id != '?') {
+                *rest = token;
+                return cond;
+        }
+
+        int64_t then = eval_expr(&token, token + 1);
+        token = skip(token, ':');
+        int64_t els = eval_expr(rest, token);
+        return cond ? then : els;
+}
+
+static Token number_token(bool val) {
+        if (!numbers[val])
+                numbers[val] = tokenize_string("<built-in>", val ? "1" : "0");
+        return *numbers[val];
+}
+
+// Evaluates the condition of #if or #elif in [token, end)
+static bool eval_condition(Token *hash, Token *token, Token *end) {
+        // "defined" is applied before the line is macro-expanded
+        TokenVec line = {};
+        for (; token < end; token++) {
+                if (ident_of(token) != name_defined) {
+                        vec_push(&line, token);
+                        continue;
+                }
+
+                Token *start = token++;
+                bool paren = token < end && token->id == '(';
+                if (paren)
+                        token++;
+                char *name = token < end ? ident_of(token) : NULL;
+                if (!name)
+                        error_tok(start, "macro name must be an identifier");
+                if (paren && (++token == end || token->id != ')'))
+                        error_tok(start, "expected ')'");
+
+                Token num = number_token(find_macro(name) != NULL);
+                vec_push(&line, &num);
+        }
+
+        TokenVec expr = expand_tokens(&line, hash);
+        Token eof = *hash;
+        eof.token_type = T_EOF;
+        eof.id = 0;
+        vec_push(&expr, &eof);
+
+        Token *rest;
+        int64_t val = eval_expr(&rest, expr.data);
+        if (rest->token_type != T_EOF)
+                error_tok(rest, "extra token");
+
+        free(line.data);
+        free(expr.data);
+        return val != 0;
+}
+
+//
+// Directives
+//
+
+// Returns the name of the include guard macro if all of the file's
+// contents are in a block of this form
+//
+//   #ifndef X
+//   #define X
+//   ...
+//   #endif
+static char *detect_guard(Token *token) {
+        if (!is_directive(token, "ifndef"))
+                return NULL;
+        char *guard = ident_of(token + 2);
+        if (!guard || (token[2].flags & TF_BOL))
+                return NULL;
+        if (!is_directive(token + 3, "define") || ident_of(token + 5) != guard || (token[5].flags & TF_BOL))
+                return NULL;
+
+        int depth = 0;
+        for (token += 6; token->token_type != T_EOF; token++) {
+                if (is_directive(token, "if") || is_directive(token, "ifdef") || is_directive(token, "ifndef")) {
+                        depth++;
+                } else if (is_directive(token, "endif")) {
+                        // The matching #endif has to end the file
+                        if (depth-- == 0)
+                                return skip_line(token + 2)->token_type == T_EOF ? guard : NULL;
+                } else if (depth == 0 && (is_directive(token, "elif") || is_directive(token, "else"))) {
+                        return NULL;
+                }
+        }
+        return NULL;
+}
+
+static Header *new_header(Arena *arena, char *path, Token *tokens) {
+        Header *header = arena_alloc(arena, sizeof(Header));
+        header->path = path;
+        header->tokens = tokens;
+        header->eof = tokens;
+        while (header->eof->token_type != T_EOF)
+                header->eof++;
+        header->guard = detect_guard(tokens);
+        return header;
+}
+
+// Adds a copy of `header` to the headers of the unit
+static Header *unit_header(Header *header) {
+        Header *copy = arena_alloc(&token_arena, sizeof(Header));
+        *copy = *header;
+        copy->next = headers;
+        headers = copy;
+        return copy;
+}
+
+// Returns the slot of `path` in the header cache. Called with cache_lock
+// held.
+static Header **cache_slot(char *path) {
+        if ((header_cache_count + 1) * 2 > header_cache_capacity) {
+                Header **old = header_cache;
+                int old_capacity = header_cache_capacity;
+                header_cache_capacity = old_capacity ? old_capacity * 2 : 256;
+                header_cache = calloc(header_cache_capacity, sizeof(Header *));
+                for (int i = 0; i < old_capacity; i++) {
+                        if (!old[i])
+                                continue;
+                        int j = ((uintptr_t)old[i]->path >> 4) & (header_cache_capacity - 1);
+                        while (header_cache[j])
+                                j = (j + 1) & (header_cache_capacity - 1);
+                        header_cache[j] = old[i];
+                }
+                free(old);
+        }
+
+        int i = ((uintptr_t)path >> 4) & (header_cache_capacity - 1);
+        while (header_cache[i] && header_cache[i]->path != path)
+                i = (i + 1) & (header_cache_capacity - 1);
+        return &header_cache[i];
+}
+
+// Returns the cached header at `path`, lexing it if no thread has yet.
+// Two threads may lex the same header at once; the first one to finish
+// has its tokens cached and used by both.
+static Header *cached_header(char *key, char *path, Token *hash) {
+        pthread_mutex_lock(&cache_lock);
+        Header *header = *cache_slot(key);
+        pthread_mutex_unlock(&cache_lock);
+        if (header)
+                return header;
+
+        Token *tokens = tokenize_header(path);
+        if (!tokens)
+                error_tok(hash, "%s: cannot open file: %s", path, strerror(errno));
+        header = new_header(&header_arena, key, tokens);
+
+        pthread_mutex_lock(&cache_lock);
+        Header **slot = cache_slot(key);
+        if (!*slot) {
+                *slot = header;
+                header_cache_count++;
+        }
+        header = *slot;
+        pthread_mutex_unlock(&cache_lock);
+        return header;
+}
+
+static char *search_include(char *path, bool quoted, Token *hash) {
+        if (path[0] == '/')
+                return path;
+
+        // A quoted name is looked up next to the including file first
+        if (quoted) {
+                char *name = token_file(hash)->name;
+                char *slash = strrchr(name, '/');
+                char *candidate = slash ? format("%.*s/%s", (int)(slash - name), name, path) : path;
+                if (!access(candidate, R_OK))
+                        return candidate;
+        }
+
+        for (int i = 0; i < include_path_count; i++) {
+                char *candidate = format("%s/%s", include_paths[i], path);
+                if (!access(candidate, R_OK))
+                        return candidate;
+                free(candidate);
+        }
+        error_tok(hash, "%s: cannot open file", path);
+        return NULL;
+}
+
+static void include_file(char *path, Token *hash) {
+        char *key = intern(path, strlen(path));
+        Header *header = headers;
+        while (header && header->path != key)
+                header = header->next;
+
+        if (header) {
+                // Nothing to do if including the file again can't make a difference
+                if (header->once || (header->guard && find_macro(header->guard)))
+                        return;
+        } else {
+                header = unit_header(cached_header(key, path, hash));
+        }
+
+        if (source_count > MAX_INCLUDE_DEPTH)
+                error_tok(hash, "#include nested too deeply");
+        push_file(header);
+}
+
+// #include "file" or #include <file>
+static void include(Token *hash, Token *token, Token *end) {
+        char *path = NULL;
+        bool quoted = token < end && token->token_type == T_STR;
+
+        if (quoted) {
+                path = token_literal(token)->str;
+        } else if (token < end && token->id == '<') {
+                Token *close = token + 1;
+                while (close < end && close->id != '>')
+                        close++;
+                if (close == end)
+                        error_tok(token, "expected '>'");
+                path = arena_strndup(&token_arena, token->loc + 1, close->loc - token->loc - 1);
+        } else {
+                error_tok(token, "expected a filename");
+        }
+
+        include_file(search_include(path, quoted, hash), hash);
+}
+
+static Token *read_params(Macro *macro, Token *token, Token *end) {
+        int capacity = 0;
+
+        while (token < end && token->id != ')') {
+                if (macro->param_count) {
+                        if (token->id != ',')
+                                error_tok(token, "expected ','");
+                        token++;
+                }
+                if (macro->is_variadic)
+                        error_tok(token, "expected ')'");
+
+                char *name;
+                if (token < end && token->id == TK_ELLIPSIS) {
+                        macro->is_variadic = true;
+                        name = name_va_args;
+                } else {
+                        name = token < end ? ident_of(token) : NULL;
+                        if (!name)
+                                error_tok(token, "expected a parameter name");
+                }
+
+                if (macro->param_count == capacity) {
+                        capacity = capacity ? capacity * 2 : 4;
+                        macro->params = realloc(macro->params, sizeof(char *) * capacity);
+                }
+                macro->params[macro->param_count++] = name;
+                token++;
+        }
+
+        if (token == end)
+                error_tok(token - 1, "unterminated macro parameter list");
+        return token + 1;
+}
+
+// #define name replacement-list
+// #define name(params) replacement-list
+static void define_macro(Token *token, Token *end) {
+        char *name = token < end ? ident_of(token) : NULL;
+        if (!name)
+                error_tok(token, "macro name must be an identifier");
+
+        Macro *macro = arena_alloc(&symbol_arena, sizeof(Macro));
+        macro->name = name;
+        token++;
+
+        // A parenthesis right after the name starts the parameter list
+        if (token < end && token->id == '(' && !(token->flags & TF_SPACE)) {
+                macro->is_function = true;
+                token = read_params(macro, token + 1, end);
+        }
+
+        macro->body = token;
+        macro->body_len = end - token;
+        for (int i = 0; i < macro->body_len; i++) {
+                if (token[i].id != TK_HASHHASH)
+                        continue;
+                if (i == 0 || i == macro->body_len - 1)
+                        error_tok(&token[i], "'##' cannot appear at either end of macro expansion");
+                macro->has_paste = true;
+        }
+        add_macro(macro);
+}
+
+static void push_cond(Token *hash, bool included) {
+        if (cond_count == cond_capacity) {
+                cond_capacity = cond_capacity ? cond_capacity * 2 : 16;
+                conds = realloc(conds, sizeof(CondIncl) * cond_capacity);
+        }
+        conds[cond_count++] = (CondIncl){IN_THEN, included, hash};
+}
+
+// Returns the innermost conditional opened in the current file
+static CondIncl *current_cond(Token *hash) {
+        if (cond_count == sources[source_count - 1].cond_depth)
+                error_tok(hash, "stray #%.*s", hash[1].len, hash[1].loc);
+        return &conds[cond_count - 1];
+}
+
+// Skips a group that is not included up to its #elif, #else or #endif
+static void skip_cond(void) {
+        Source *src = &sources[source_count - 1];
+        Token *token = src->cur;
+        int depth = 0;
+
+        for (; token->token_type != T_EOF; token++) {
+                if (is_directive(token, "if") || is_directive(token, "ifdef") || is_directive(token, "ifndef")) {
+                        depth++;
+                } else if (is_directive(token, "endif")) {
+                        if (depth-- == 0)
+                                break;
+                } else if (depth == 0 && (is_directive(token, "elif") || is_directive(token, "else"))) {
+                        break;
+                }
+        }
+        src->cur = token;
+}
+
+// Executes the directive starting at the "#" just read from the current file
+static void directive(void) {
+        Source *src = &sources[source_count - 1];
+        Token *hash = src->cur - 1;
+        Token *token = src->cur;
+
+        // A "#" alone on a line does nothing
+        if (token->token_type == T_EOF || (token->flags & TF_BOL))
+                return;
+
+        char *name = ident_of(token);
+        if (!name)
+                error_tok(token, "invalid preprocessor directive");
+
+        Token *end = skip_line(token + 1);
+        src->cur = end;
+        token++;
+
+        if (!strcmp(name, "include")) {
+                include(hash, token, end);
+                return;
+        }
+
+        if (!strcmp(name, "define")) {
+                define_macro(token, end);
+                return;
+        }
+
+        if (!strcmp(name, "undef")) {
+                char *macro_name = token < end ? ident_of(token) : NULL;
+                if (!macro_name)
+                        error_tok(token, "macro name must be an identifier");
+                Macro *macro = find_macro(macro_name);
+                if (macro)
+                        macro->is_deleted = true;
+                return;
+        }
+
+        if (!strcmp(name, "ifdef") || !strcmp(name, "ifndef")) {
+                char *macro_name = token < end ? ident_of(token) : NULL;
+                if (!macro_name)
+                        error_tok(token, "macro name must be an identifier");
+                bool included = (find_macro(macro_name) != NULL) == (name[2] == 'd');
+                push_cond(hash, included);
+                if (!included)
+                        skip_cond();
+                return;
+        }
+
+        if (!strcmp(name, "if")) {
+                bool included = eval_condition(hash, token, end);
+                push_cond(hash, included);
+                if (!included)
+                        skip_cond();
+                return;
+        }
+
+        if (!strcmp(name, "elif")) {
+                CondIncl *cond = current_cond(hash);
+                if (cond->ctx == IN_ELSE)
+                        error_tok(hash, "#elif after #else");
+                cond->ctx = IN_ELIF;
+                if (!cond->included && eval_condition(hash, token, end))
+                        cond->included = true;
+                else
+                        skip_cond();
+                return;
+        }
+
+        if (!strcmp(name, "else")) {
+                CondIncl *cond = current_cond(hash);
+                if (cond->ctx == IN_ELSE)
+                        error_tok(hash, "#else after #else");
+                cond->ctx = IN_ELSE;
+                if (cond->included)
+                        skip_cond();
+                cond->included = true;
+                return;
+        }
+
+        if (!strcmp(name, "endif")) {
+                current_cond(hash);
+                cond_count--;
+                return;
+        }
+
+        if (!strcmp(name, "pragma")) {
+                if (token < end && ident_of(token) && !strcmp(token->ident, "once"))
+                        src->header->once = true;
+                return;
+        }
+
+        if (!strcmp(name, "error")) {
+                Token *last = end - 1;
+                error_tok(hash, "#error %.*s", (int)(last->loc + last->len - token->loc), token->loc);
+        }
+
+        error_tok(token - 1, "invalid preprocessor directive");
+}
+
+// Returns a new token array with the directives of `tokens` executed
+// and macros expanded
+Token *preprocess(Token *tokens) {
+        name_defined = intern("defined", 7);
+        name_va_args = intern("__VA_ARGS__", 11);
+
+        File *file = token_file(tokens);
+        push_file(unit_header(new_header(&token_arena, intern(file->name, strlen(file->name)), tokens)));
+
+        for (;;) {
+                Token token = expand_next();
+
+                if (token.id == '#' && (token.flags & TF_BOL) && sources[source_count - 1].header) {
+                        directive();
+                        continue;
+                }
+
+                emit(&token);
+                if (token.token_type == T_EOF)
+                        break;
+        }
+
+        if (cond_count)
+                error_tok(conds[cond_count - 1].token, "unterminated conditional directive");
+        return arena_resize_block(&token_arena, out, sizeof(Token) * out_count);
+}
+
+// Prints the tokens the way they were laid out in the source (-E)
+void print_tokens(Token *token, FILE *out) {
+        for (int i = 0; token->token_type != T_EOF; token++, i++) {
+                if (i && (token->flags & TF_BOL))
+                        fputc('\n', out);
+                else if (i && (token->flags & TF_SPACE))
+                        fputc(' ', out);
+                fprintf(out, "%.*s", token->len, token->loc);
+        }
+        fputc('\n', out);
+}
+
+// Forgets the macros and headers of the last translation unit. The
+// source and conditional stacks keep their buffers, and the header
+// cache is kept for the units to come.
+void reset_preprocessor(void) {
+        source_count = cond_count = 0;
+        free(macros);
+        macros = NULL;
+        macro_count = macro_capacity = 0;
+        headers = NULL;
+        out = NULL;
+        out_count = out_capacity = 0;
+        numbers[0] = numbers[1] = NULL;
+}
@@ -0,0 +1,260 @@
+#include "token.h"
+
+// Linear-scan register allocation (Poletto and Sarkar, 1999) for -O1.
+// Every virtual register gets one live interval, from the first to the
+// last point it is live at in emission order. The intervals are visited
+// by increasing start; each takes a free machine register, and when
+// there is none, whichever of it and the active intervals ends last is
+// spilled to a stack slot.
+//
+// Instruction i reads its operands at point 2i and writes its result at
+// 2i + 1, so a result can reuse the register of an operand that dies
+// in the same instruction.
+//
+// Only virtual registers that are live across a block boundary need
+// dataflow analysis; the intervals of the others follow from where
+// they are read and written.
+
+typedef struct {
+        int vreg;
+        int start;
+        int end;
+        bool crosses_call;
+} Interval;
+
+typedef uint64_t Bits;
+
+static bool test_bit(Bits *set, int i) {
+        return set[i / 64] >> (i % 64) & 1;
+}
+
+static void set_bit(Bits *set, int i) {
+        set[i / 64] |= (Bits)1 << (i % 64);
+}
+
+static int compare_intervals(const void *x, const void *y) {
+        const Interval *a = x, *b = y;
+        if (a->start != b->start)
+                return a->start < b->start ? -1 : 1;
+        return a->vreg - b->vreg;
+}
+
+// Computes the live interval of every virtual register that is used,
+// sorted by start
+static Interval *build_intervals(IRFunc *func, int *count) {
+        int nvregs = func->vreg_count + 1;
+        int nblocks = func->block_count;
+        IRBlock **blocks = calloc(nblocks, sizeof(IRBlock *));
+        for (IRBlock *block = func->blocks; block; block = block->next)
+                blocks[block->id] = block;
+
+        // A virtual register needs dataflow analysis if it appears in
+        // more than one block or is read before it is written in its block
+        int *home = malloc(sizeof(int) * nvregs);
+        int *global = malloc(sizeof(int) * nvregs); // Index into the bit sets, or -1
+        for (int v = 0; v < nvregs; v++)
+                home[v] = global[v] = -1;
+
+        int nglobals = 0;
+        int regs[8];
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        for (int i = 0, n = ir_uses(inst, regs); i < n; i++) {
+                                int v = regs[i];
+                                if (home[v] != block->id && global[v] < 0)
+                                        global[v] = nglobals++;
+                                home[v] = block->id;
+                        }
+                        for (int i = 0, n = ir_defs(inst, regs); i < n; i++) {
+                                int v = regs[i];
+                                if (home[v] >= 0 && home[v] != block->id && global[v] < 0)
+                                        global[v] = nglobals++;
+                                home[v] = block->id;
+                        }
+                }
+        }
+
+        // Live-in and live-out sets of the global virtual registers
+        int words = (nglobals + 63) / 64;
+        Bits *bits = calloc((size_t)nblocks * words * 4 + 1, sizeof(Bits));
+        Bits *use = bits;
+        Bits *def = use + (size_t)nblocks * words;
+        Bits *in = def + (size_t)nblocks * words;
+        Bits *out = in + (size_t)nblocks * words;
+
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                Bits *u = use + (size_t)block->id * words;
+                Bits *d = def + (size_t)block->id * words;
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        for (int i = 0, n = ir_uses(inst, regs); i < n; i++)
+                                if (global[regs[i]] >= 0 && !test_bit(d, global[regs[i]]))
+                                        set_bit(u, global[regs[i]]);
+                        for (int i = 0, n = ir_defs(inst, regs); i < n; i++)
+                                if (global[regs[i]] >= 0)
+                                        set_bit(d, global[regs[i]]);
+                }
+        }
+
+        for (bool changed = true; changed && words;) {
+                changed = false;
+                for (int b = nblocks - 1; b >= 0; b--) {
+                        IRBlock *succ[2];
+                        int nsucc = ir_successors(blocks[b], succ);
+                        Bits *o = out + (size_t)b * words;
+                        Bits *i = in + (size_t)b * words;
+                        Bits *u = use + (size_t)b * words;
+                        Bits *d = def + (size_t)b * words;
+                        for (int w = 0; w < words; w++) {
+                                Bits live = o[w];
+                                for (int s = 0; s < nsucc; s++)
+                                        live |= in[(size_t)succ[s]->id * words + w];
+                                Bits live_in = u[w] | (live & ~d[w]);
+                                if (live != o[w] || live_in != i[w])
+                                        changed = true;
+                                o[w] = live;
+                                i[w] = live_in;
+                        }
+                }
+        }
+
+        // Widen the intervals over the instructions and blocks every
+        // virtual register is live at, and count the calls before each
+        // instruction
+        int *start = malloc(sizeof(int) * nvregs);
+        int *end = malloc(sizeof(int) * nvregs);
+        for (int v = 0; v < nvregs; v++) {
+                start[v] = INT32_MAX;
+                end[v] = -1;
+        }
+
+        int *globals = malloc(sizeof(int) * (nglobals + 1));
+        for (int v = 0; v < nvregs; v++)
+                if (global[v] >= 0)
+                        globals[global[v]] = v;
+
+        int ninsts = 0;
+        for (IRBlock *block = func->blocks; block; block = block->next)
+                for (IRInst *inst = block->insts; inst; inst = inst->next)
+                        ninsts++;
+        int *calls_before = calloc(ninsts + 1, sizeof(int));
+
+#define EXTEND(v, point) do { \
+        if ((point) < start[v]) start[v] = (point); \
+        if ((point) > end[v]) end[v] = (point); \
+} while (0)
+
+        int pos = 0;
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                int first = pos;
+                for (IRInst *inst = block->insts; inst; inst = inst->next, pos++) {
+                        calls_before[pos + 1] = calls_before[pos] + (inst->op == IR_CALL);
+                        for (int i = 0, n = ir_uses(inst, regs); i < n; i++)
+                                EXTEND(regs[i], 2 * pos);
+                        for (int i = 0, n = ir_defs(inst, regs); i < n; i++)
+                                EXTEND(regs[i], 2 * pos + 1);
+                }
+
+                Bits *i = in + (size_t)block->id * words;
+                Bits *o = out + (size_t)block->id * words;
+                for (int g = 0; g < nglobals; g++) {
+                        if (test_bit(i, g))
+                                EXTEND(globals[g], 2 * first);
+                        if (test_bit(o, g))
+                                EXTEND(globals[g], 2 * pos - 1);
+                }
+        }
+
+#undef EXTEND
+
+        Interval *intervals = malloc(sizeof(Interval) * nvregs);
+        int n = 0;
+        for (int v = 1; v < nvregs; v++) {
+                if (end[v] < 0)
+                        continue;
+                // A value is live across instruction i if it is live
+                // at point 2i and still needed at point 2i + 2
+                int first_call = (start[v] + 1) / 2;
+                int last_call = end[v] / 2 - 1;
+                bool crosses_call = first_call <= last_call &&
+                        calls_before[last_call + 1] - calls_before[first_call] > 0;
+                intervals[n++] = (Interval){v, start[v], end[v], crosses_call};
+        }
+        qsort(intervals, n, sizeof(Interval), compare_intervals);
+
+        free(blocks);
+        free(home);
+        free(global);
+        free(bits);
+        free(start);
+        free(end);
+        free(globals);
+        free(calls_before);
+        *count = n;
+        return intervals;
+}
+
+static void spill(IRFunc *func, int vreg) {
+        func->reg[vreg] = -1;
+        func->spill[vreg] = func->spill_count++;
+}
+
+// Assigns a machine register or a spill slot to every virtual register
+void allocate_registers(IRFunc *func) {
+        int count;
+        Interval *intervals = build_intervals(func, &count);
+
+        func->reg = arena_alloc(&ir_arena, sizeof(int) * (func->vreg_count + 1));
+        func->spill = arena_alloc(&ir_arena, sizeof(int) * (func->vreg_count + 1));
+
+        // Intervals that hold a register, ordered by end
+        Interval *active[REG_ALLOCATABLE];
+        int nactive = 0;
+        bool used[REG_ALLOCATABLE] = {};
+
+        for (int i = 0; i < count; i++) {
+                Interval *cur = &intervals[i];
+
+                // Free the registers of intervals that have ended
+                int kept = 0;
+                for (int j = 0; j < nactive; j++) {
+                        if (active[j]->end < cur->start)
+                                used[func->reg[active[j]->vreg]] = false;
+                        else
+                                active[kept++] = active[j];
+                }
+                nactive = kept;
+
+                // Values live across a call must be in callee-saved registers
+                int first = cur->crosses_call ? REG_FIRST_CALLEE_SAVED : 0;
+                int reg = first;
+                while (reg < REG_ALLOCATABLE && used[reg])
+                        reg++;
+
+                if (reg == REG_ALLOCATABLE) {
+                        // Spill whichever ends last: `cur` or an active
+                        // interval with a register `cur` may have
+                        int victim = -1;
+                        for (int j = 0; j < nactive; j++)
+                                if (func->reg[active[j]->vreg] >= first &&
+                                                (victim < 0 || active[j]->end > active[victim]->end))
+                                        victim = j;
+                        if (victim < 0 || active[victim]->end <= cur->end) {
+                                spill(func, cur->vreg);
+                                continue;
+                        }
+                        reg = func->reg[active[victim]->vreg];
+                        spill(func, active[victim]->vreg);
+                        nactive--;
+                        for (int j = victim; j < nactive; j++)
+                                active[j] = active[j + 1];
+                }
+
+                func->reg[cur->vreg] = reg;
+                used[reg] = true;
+                int j = nactive++;
+                for (; j > 0 && active[j - 1]->end > cur->end; j--)
+                        active[j] = active[j - 1];
+                active[j] = cur;
+        }
+        free(intervals);
+}
@@ -0,0 +1,213 @@
+#include "token.h"
+
+// Character class scanners for the lexer's hot loops: runs of blanks,
+// identifier bodies, and the characters that end comments and string
+// literals. On x86-64 they look at 16 (SSE2) or 32 (AVX2) bytes at a
+// time; the widest version the CPU supports is picked at startup.
+//
+// Every scanner stops at '\0', and blocks are loaded from aligned
+// addresses only. An aligned load never crosses a page boundary, so
+// reading the rest of the block that holds the terminating '\0' can't
+// fault even when the input ends right before an unmapped page.
+
+enum {
+        SCAN_BLANKS, // Skip ' ', '\t', '\v', '\f' and '\r'
+        SCAN_IDENT, // Skip [A-Za-z0-9_]
+        SCAN_NEWLINE, // Find '\n'
+        SCAN_COMMENT, // Find '*' or '\n'
+        SCAN_STRING, // Find '"', '\\' or '\n'
+};
+
+static bool is_blank(char c) {
+        return c == ' ' || c == '\t' || c == '\v' || c == '\f' || c == '\r';
+}
+
+static bool is_ident(char c) {
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+}
+
+static inline bool is_stop(char c, int kind) {
+        switch (kind) {
+                case SCAN_BLANKS:
+                        return !is_blank(c);
+                case SCAN_IDENT:
+                        return !is_ident(c);
+                case SCAN_NEWLINE:
+                        return c == '\n' || c == '\0';
+                case SCAN_COMMENT:
+                        return c == '*' || c == '\n' || c == '\0';
+                default:
+                        return c == '"' || c == '\\' || c == '\n' || c == '\0';
+        }
+}
+
+static inline char *scan_scalar(char *p, int kind) {
+        while (!is_stop(*p, kind))
+                p++;
+        return p;
+}
+
+static char *skip_blanks_scalar(char *p) { return scan_scalar(p, SCAN_BLANKS); }
+static char *skip_ident_scalar(char *p) { return scan_scalar(p, SCAN_IDENT); }
+static char *find_newline_scalar(char *p) { return scan_scalar(p, SCAN_NEWLINE); }
+static char *find_comment_char_scalar(char *p) { return scan_scalar(p, SCAN_COMMENT); }
+static char *find_string_char_scalar(char *p) { return scan_scalar(p, SCAN_STRING); }
+
+#ifdef __x86_64__
+#include <immintrin.h>
+
+// SSE2 is part of the x86-64 baseline, so this needs no target attribute
+
+// Bytes of `v` in [lo, hi]. Biasing by 0x80 - lo turns the unsigned range
+// check into a single signed compare.
+static inline __m128i in_range_sse2(__m128i v, char lo, char hi) {
+        __m128i t = _mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - lo)));
+        return _mm_cmplt_epi8(t, _mm_set1_epi8((char)(0x80 + hi - lo + 1)));
+}
+
+static inline uint32_t stop_mask_sse2(__m128i v, int kind) {
+        __m128i m;
+        switch (kind) {
+                case SCAN_BLANKS:
+                        m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                        _mm_andnot_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                                in_range_sse2(v, '\t', '\r')));
+                        return ~_mm_movemask_epi8(m) & 0xffff;
+                case SCAN_IDENT:
+                        m = _mm_or_si128(in_range_sse2(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'),
+                                        _mm_or_si128(in_range_sse2(v, '0', '9'),
+                                                _mm_cmpeq_epi8(v, _mm_set1_epi8('_'))));
+                        return ~_mm_movemask_epi8(m) & 0xffff;
+                case SCAN_NEWLINE:
+                        m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                        _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+                        return _mm_movemask_epi8(m);
+                case SCAN_COMMENT:
+                        m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('*')),
+                                        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                                _mm_cmpeq_epi8(v, _mm_setzero_si128())));
+                        return _mm_movemask_epi8(m);
+                default:
+                        m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                                _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+                                        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                                _mm_cmpeq_epi8(v, _mm_setzero_si128())));
+                        return _mm_movemask_epi8(m);
+        }
+}
+
+static inline char *scan_sse2(char *p, int kind) {
+        uintptr_t off = (uintptr_t)p & 15;
+        char *q = p - off;
+        uint32_t mask = stop_mask_sse2(_mm_load_si128((__m128i *)q), kind) & (0xffffu << off);
+        while (!mask) {
+                q += 16;
+                mask = stop_mask_sse2(_mm_load_si128((__m128i *)q), kind);
+        }
+        return q + __builtin_ctz(mask);
+}
+
+static char *skip_blanks_sse2(char *p) { return scan_sse2(p, SCAN_BLANKS); }
+static char *skip_ident_sse2(char *p) { return scan_sse2(p, SCAN_IDENT); }
+static char *find_newline_sse2(char *p) { return scan_sse2(p, SCAN_NEWLINE); }
+static char *find_comment_char_sse2(char *p) { return scan_sse2(p, SCAN_COMMENT); }
+static char *find_string_char_sse2(char *p) { return scan_sse2(p, SCAN_STRING); }
+
+#define AVX2 __attribute__((target("avx2")))
+
+static inline AVX2 __m256i in_range_avx2(__m256i v, char lo, char hi) {
+        __m256i t = _mm256_add_epi8(v, _mm256_set1_epi8((char)(0x80 - lo)));
+        return _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(0x80 + hi - lo + 1)), t);
+}
+
+static inline AVX2 uint32_t stop_mask_avx2(__m256i v, int kind) {
+        __m256i m;
+        switch (kind) {
+                case SCAN_BLANKS:
+                        m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                        _mm256_andnot_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                                                in_range_avx2(v, '\t', '\r')));
+                        return ~(uint32_t)_mm256_movemask_epi8(m);
+                case SCAN_IDENT:
+                        m = _mm256_or_si256(in_range_avx2(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z'),
+                                        _mm256_or_si256(in_range_avx2(v, '0', '9'),
+                                                _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'))));
+                        return ~(uint32_t)_mm256_movemask_epi8(m);
+                case SCAN_NEWLINE:
+                        m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                                        _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+                        return _mm256_movemask_epi8(m);
+                case SCAN_COMMENT:
+                        m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('*')),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                                                _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+                        return _mm256_movemask_epi8(m);
+                default:
+                        m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                                                _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                                                _mm256_cmpeq_epi8(v, _mm256_setzero_si256())));
+                        return _mm256_movemask_epi8(m);
+        }
+}
+
+static inline AVX2 char *scan_avx2(char *p, int kind) {
+        uintptr_t off = (uintptr_t)p & 31;
+        char *q = p - off;
+        uint32_t mask = stop_mask_avx2(_mm256_load_si256((__m256i *)q), kind) & (0xffffffffu << off);
+        while (!mask) {
+                q += 32;
+                mask = stop_mask_avx2(_mm256_load_si256((__m256i *)q), kind);
+        }
+        return q + __builtin_ctz(mask);
+}
+
+static AVX2 char *skip_blanks_avx2(char *p) { return scan_avx2(p, SCAN_BLANKS); }
+static AVX2 char *skip_ident_avx2(char *p) { return scan_avx2(p, SCAN_IDENT); }
+static AVX2 char *find_newline_avx2(char *p) { return scan_avx2(p, SCAN_NEWLINE); }
+static AVX2 char *find_comment_char_avx2(char *p) { return scan_avx2(p, SCAN_COMMENT); }
+static AVX2 char *find_string_char_avx2(char *p) { return scan_avx2(p, SCAN_STRING); }
+#endif
+
+Scanner scanner = {
+        "scalar",
+        skip_blanks_scalar,
+        skip_ident_scalar,
+        find_newline_scalar,
+        find_comment_char_scalar,
+        find_string_char_scalar,
+};
+
+// Picks the widest implementation the CPU supports. SCAN_ISA=scalar,
+// sse2 or avx2 in the environment overrides the choice, which is how
+// the narrower versions get tested on machines that have AVX2.
+__attribute__((constructor))
+static void init_scanner(void) {
+#ifdef __x86_64__
+        char *isa = getenv("SCAN_ISA");
+        if (isa && !strcmp(isa, "scalar"))
+                return;
+
+        __builtin_cpu_init();
+        if ((!isa || !strcmp(isa, "avx2")) && __builtin_cpu_supports("avx2")) {
+                scanner = (Scanner){
+                        "avx2",
+                        skip_blanks_avx2,
+                        skip_ident_avx2,
+                        find_newline_avx2,
+                        find_comment_char_avx2,
+                        find_string_char_avx2,
+                };
+                return;
+        }
+
+        scanner = (Scanner){
+                "sse2",
+                skip_blanks_sse2,
+                skip_ident_sse2,
+                find_newline_sse2,
+                find_comment_char_sse2,
+                find_string_char_sse2,
+        };
+#endif
+}
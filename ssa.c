@@ -0,0 +1,733 @@
+#include "token.h"
+
+// SSA form of the -O1 IR. to_ssa() promotes the scalar locals whose
+// address is never taken from memory to virtual registers, like LLVM's
+// mem2reg: phis go to the iterated dominance frontiers of the blocks
+// that store to a variable (Cytron et al., 1991), and a walk over the
+// dominator tree then replaces every load with the value stored last.
+// Dominators are found with the algorithm of Cooper, Harvey and
+// Kennedy.
+//
+// The SSA values a variable takes on are its versions. No optimization
+// here keeps two versions of a variable alive at the same time, so
+// leave_ssa() renames all of them back to one virtual register per
+// variable, which leaves the phis nothing to do.
+
+typedef struct {
+        int *items;
+        int len;
+        int cap;
+} IntList;
+
+static void push(IntList *list, int x) {
+        if (list->len == list->cap) {
+                list->cap = list->cap ? list->cap * 2 : 4;
+                list->items = realloc(list->items, sizeof(int) * list->cap);
+        }
+        list->items[list->len++] = x;
+}
+
+// Pointers to the virtual registers `inst` reads
+static int use_slots(IRInst *inst, int **slots) {
+        int n = 0;
+        if (inst->op == IR_CALL || inst->op == IR_PHI)
+                for (int i = 0; i < inst->nargs; i++)
+                        slots[n++] = &inst->args[i];
+        if (inst->a)
+                slots[n++] = &inst->a;
+        if (inst->b)
+                slots[n++] = &inst->b;
+        return n;
+}
+
+// Room for the operands of any instruction but a phi
+#define MAX_SLOTS 8
+
+static int **alloc_slots(IRInst *inst, int **buf) {
+        if (inst->op == IR_PHI && inst->nargs > MAX_SLOTS)
+                return malloc(sizeof(int *) * inst->nargs);
+        return buf;
+}
+
+// Unlinks the blocks that can not be reached from the entry, renumbers
+// the others and records the predecessors of each. Returns the blocks
+// by id.
+static IRBlock **find_predecessors(IRFunc *func) {
+        int n = func->block_count;
+        bool *reached = calloc(n, sizeof(bool));
+        IRBlock **stack = malloc(sizeof(IRBlock *) * n);
+        int sp = 0;
+        reached[func->blocks->id] = true;
+        stack[sp++] = func->blocks;
+        while (sp) {
+                IRBlock *block = stack[--sp];
+                IRBlock *succ[2];
+                for (int i = 0, k = ir_successors(block, succ); i < k; i++) {
+                        if (!reached[succ[i]->id]) {
+                                reached[succ[i]->id] = true;
+                                stack[sp++] = succ[i];
+                        }
+                }
+        }
+
+        int id = 0;
+        for (IRBlock **p = &func->blocks; *p;) {
+                IRBlock *block = *p;
+                if (!reached[block->id]) {
+                        *p = block->next;
+                        continue;
+                }
+                block->id = id++;
+                block->npreds = 0;
+                p = &block->next;
+        }
+        func->block_count = id;
+
+        IRBlock **blocks = malloc(sizeof(IRBlock *) * id);
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                blocks[block->id] = block;
+                IRBlock *succ[2];
+                for (int i = 0, k = ir_successors(block, succ); i < k; i++)
+                        succ[i]->npreds++;
+        }
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                block->preds = arena_alloc(&ir_arena, sizeof(IRBlock *) * block->npreds);
+                block->npreds = 0;
+        }
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                IRBlock *succ[2];
+                for (int i = 0, k = ir_successors(block, succ); i < k; i++)
+                        succ[i]->preds[succ[i]->npreds++] = block;
+        }
+
+        free(reached);
+        free(stack);
+        return blocks;
+}
+
+static int intersect(int *idom, int *post, int a, int b) {
+        while (a != b) {
+                while (post[a] < post[b])
+                        a = idom[a];
+                while (post[b] < post[a])
+                        b = idom[b];
+        }
+        return a;
+}
+
+// Returns the immediate dominator of every block by id; the entry,
+// block 0, is its own
+static int *find_dominators(IRFunc *func, IRBlock **blocks) {
+        int n = func->block_count;
+        int *post = malloc(sizeof(int) * n); // Postorder number of each block
+        int *order = malloc(sizeof(int) * n); // Blocks in postorder
+        int *stack = malloc(sizeof(int) * n);
+        int *next_succ = calloc(n, sizeof(int));
+        bool *visited = calloc(n, sizeof(bool));
+
+        int count = 0;
+        int sp = 0;
+        stack[sp++] = 0;
+        visited[0] = true;
+        while (sp) {
+                int b = stack[sp - 1];
+                IRBlock *succ[2];
+                int nsucc = ir_successors(blocks[b], succ);
+                if (next_succ[b] < nsucc) {
+                        IRBlock *s = succ[next_succ[b]++];
+                        if (!visited[s->id]) {
+                                visited[s->id] = true;
+                                stack[sp++] = s->id;
+                        }
+                        continue;
+                }
+                post[b] = count;
+                order[count++] = b;
+                sp--;
+        }
+
+        int *idom = malloc(sizeof(int) * n);
+        for (int i = 0; i < n; i++)
+                idom[i] = -1;
+        idom[0] = 0;
+
+        // Visit the blocks in reverse postorder until nothing changes
+        for (bool changed = true; changed;) {
+                changed = false;
+                for (int i = count - 2; i >= 0; i--) {
+                        IRBlock *block = blocks[order[i]];
+                        int new_idom = -1;
+                        for (int j = 0; j < block->npreds; j++) {
+                                int p = block->preds[j]->id;
+                                if (idom[p] < 0)
+                                        continue;
+                                new_idom = new_idom < 0 ? p : intersect(idom, post, p, new_idom);
+                        }
+                        if (idom[block->id] != new_idom) {
+                                idom[block->id] = new_idom;
+                                changed = true;
+                        }
+                }
+        }
+
+        free(post);
+        free(order);
+        free(stack);
+        free(next_succ);
+        free(visited);
+        return idom;
+}
+
+static bool is_promotable(IRInst *inst) {
+        if ((inst->op != IR_LOAD && inst->op != IR_STORE) || !inst->var || !inst->var->is_local)
+                return false;
+        TypeKind kind = inst->var->type->kind;
+        return !inst->var->is_address_taken && kind != TY_STRUCT && kind != TY_UNION && kind != TY_ARRAY;
+}
+
+static void insert_phi(IRFunc *func, IRBlock *block, Obj *var) {
+        IRInst *phi = arena_alloc(&ir_arena, sizeof(IRInst));
+        phi->op = IR_PHI;
+        phi->size = 8;
+        phi->file = block->insts->file;
+        phi->line = block->insts->line;
+        phi->dst = ++func->vreg_count;
+        phi->var = var;
+        phi->args = arena_alloc(&ir_arena, sizeof(int) * block->npreds);
+        phi->nargs = block->npreds;
+        phi->next = block->insts;
+        block->insts = phi;
+}
+
+// State of the renaming walk over the dominator tree
+typedef struct {
+        IRFunc *func;
+        int first_var; // Virtual register of the first promoted variable
+        int *cur; // Current version of every promoted variable
+        int *replace; // Value each removed load stands for
+        int *use_count;
+        IntList undo; // Variable and previous version of every new version
+} Renamer;
+
+static void set_version(Renamer *r, int var, int v) {
+        push(&r->undo, var);
+        push(&r->undo, r->cur[var]);
+        r->cur[var] = v;
+}
+
+static void rename_block(Renamer *r, IRBlock *block) {
+        int *version_of = r->func->version_of;
+        IRInst head = {.next = block->insts};
+        IRInst *prev = &head;
+        for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                if (inst->op == IR_PHI) {
+                        version_of[inst->dst] = inst->var->vreg;
+                        set_version(r, inst->var->vreg - r->first_var, inst->dst);
+                        prev = inst;
+                        continue;
+                }
+
+                int *slots[MAX_SLOTS];
+                for (int i = 0, n = use_slots(inst, slots); i < n; i++)
+                        if (r->replace[*slots[i]])
+                                *slots[i] = r->replace[*slots[i]];
+
+                if (!is_promotable(inst)) {
+                        prev = inst;
+                        continue;
+                }
+
+                int home = inst->var->vreg;
+                int var = home - r->first_var;
+                if (inst->op == IR_LOAD) {
+                        r->replace[inst->dst] = r->cur[var];
+                        prev->next = inst->next;
+                        continue;
+                }
+
+                // A temporary stored right after it is computed, or while
+                // the variable has no value yet, becomes the new version
+                // itself. Anything else is copied so that the live ranges
+                // of the versions do not overlap.
+                int v = inst->b;
+                if (!version_of[v] && r->use_count[v] == 1 &&
+                                (prev->dst == v || r->cur[var] == home)) {
+                        version_of[v] = home;
+                        set_version(r, var, v);
+                        prev->next = inst->next;
+                        continue;
+                }
+
+                int copy = ++r->func->vreg_count;
+                version_of[copy] = home;
+                *inst = (IRInst){.next = inst->next, .op = IR_MOV, .size = 8, .file = inst->file, .line = inst->line, .dst = copy, .a = v};
+                set_version(r, var, copy);
+                prev = inst;
+        }
+        block->insts = head.next;
+        block->last = prev == &head ? NULL : prev;
+
+        IRBlock *succ[2];
+        for (int i = 0, n = ir_successors(block, succ); i < n; i++)
+                for (IRInst *phi = succ[i]->insts; phi && phi->op == IR_PHI; phi = phi->next)
+                        for (int j = 0; j < succ[i]->npreds; j++)
+                                if (succ[i]->preds[j] == block)
+                                        phi->args[j] = r->cur[phi->var->vreg - r->first_var];
+}
+
+// Promotes local variables to SSA values
+void to_ssa(IRFunc *func) {
+        IRBlock **blocks = find_predecessors(func);
+        int *idom = find_dominators(func, blocks);
+        int n = func->block_count;
+
+        // Number the promotable variables and find the blocks that store
+        // to each
+        int first_var = func->vreg_count + 1;
+        int nvars = 0;
+        int nstores = 0;
+        Obj **vars = NULL;
+        IntList *stores = NULL;
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (!is_promotable(inst))
+                                continue;
+                        Obj *var = inst->var;
+                        if (!var->vreg) {
+                                var->vreg = ++func->vreg_count;
+                                vars = realloc(vars, sizeof(Obj *) * (nvars + 1));
+                                stores = realloc(stores, sizeof(IntList) * (nvars + 1));
+                                vars[nvars] = var;
+                                stores[nvars++] = (IntList){};
+                        }
+                        if (inst->op == IR_STORE) {
+                                IntList *list = &stores[var->vreg - first_var];
+                                if (!list->len || list->items[list->len - 1] != block->id)
+                                        push(list, block->id);
+                                nstores++;
+                        }
+                }
+        }
+
+        // Dominance frontiers
+        IntList *df = calloc(n, sizeof(IntList));
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                if (block->npreds < 2)
+                        continue;
+                for (int i = 0; i < block->npreds; i++) {
+                        int runner = block->preds[i]->id;
+                        while (runner != idom[block->id]) {
+                                IntList *list = &df[runner];
+                                if (!list->len || list->items[list->len - 1] != block->id)
+                                        push(list, block->id);
+                                runner = idom[runner];
+                        }
+                }
+        }
+
+        // Place phis at the iterated dominance frontier of the stores
+        int *has_phi = calloc(n, sizeof(int));
+        int *queued = calloc(n, sizeof(int));
+        IntList work = {};
+        for (int var = 0; var < nvars; var++) {
+                int stamp = var + 1;
+                for (int i = 0; i < stores[var].len; i++) {
+                        queued[stores[var].items[i]] = stamp;
+                        push(&work, stores[var].items[i]);
+                }
+                while (work.len) {
+                        int b = work.items[--work.len];
+                        for (int i = 0; i < df[b].len; i++) {
+                                int d = df[b].items[i];
+                                if (has_phi[d] == stamp)
+                                        continue;
+                                has_phi[d] = stamp;
+                                insert_phi(func, blocks[d], vars[var]);
+                                if (queued[d] != stamp) {
+                                        queued[d] = stamp;
+                                        push(&work, d);
+                                }
+                        }
+                }
+        }
+
+        // Rename in a preorder walk over the dominator tree. Every
+        // variable starts out as its own register, standing for an
+        // uninitialized value.
+        int nvregs = func->vreg_count + nstores + 1;
+        func->version_of = arena_alloc(&ir_arena, sizeof(int) * nvregs);
+        Renamer r = {func, first_var};
+        r.cur = malloc(sizeof(int) * (nvars + 1));
+        for (int var = 0; var < nvars; var++)
+                r.cur[var] = func->version_of[first_var + var] = first_var + var;
+        r.replace = calloc(nvregs, sizeof(int));
+        r.use_count = calloc(nvregs, sizeof(int));
+        int uses[MAX_SLOTS];
+        for (IRBlock *block = func->blocks; block; block = block->next)
+                for (IRInst *inst = block->insts; inst; inst = inst->next)
+                        for (int i = 0, k = ir_uses(inst, uses); i < k; i++)
+                                r.use_count[uses[i]]++;
+
+        int *first_child = malloc(sizeof(int) * n);
+        int *sibling = malloc(sizeof(int) * n);
+        for (int b = 0; b < n; b++)
+                first_child[b] = -1;
+        for (int b = n - 1; b > 0; b--) {
+                sibling[b] = first_child[idom[b]];
+                first_child[idom[b]] = b;
+        }
+
+        int *stack = malloc(sizeof(int) * n);
+        int *mark = malloc(sizeof(int) * n);
+        bool *entered = calloc(n, sizeof(bool));
+        int sp = 0;
+        stack[sp++] = 0;
+        while (sp) {
+                int b = stack[sp - 1];
+                if (!entered[b]) {
+                        entered[b] = true;
+                        mark[b] = r.undo.len;
+                        rename_block(&r, blocks[b]);
+                        for (int c = first_child[b]; c >= 0; c = sibling[c])
+                                stack[sp++] = c;
+                        continue;
+                }
+                while (r.undo.len > mark[b]) {
+                        r.undo.len -= 2;
+                        r.cur[r.undo.items[r.undo.len]] = r.undo.items[r.undo.len + 1];
+                }
+                sp--;
+        }
+
+        for (int var = 0; var < nvars; var++)
+                free(stores[var].items);
+        for (int b = 0; b < n; b++)
+                free(df[b].items);
+        free(vars);
+        free(stores);
+        free(df);
+        free(has_phi);
+        free(queued);
+        free(work.items);
+        free(r.cur);
+        free(r.replace);
+        free(r.use_count);
+        free(r.undo.items);
+        free(first_child);
+        free(sibling);
+        free(stack);
+        free(mark);
+        free(entered);
+        free(blocks);
+        free(idom);
+}
+
+// Computes `inst` on constant operands the way the machine would.
+// Division by zero or -1 is left for run time.
+static bool fold(IRInst *inst, int64_t a, int64_t b, int64_t *val) {
+        if (inst->size == 4) {
+                a = (int32_t)a;
+                b = (int32_t)b;
+        }
+
+        uint64_t x = a, y = b;
+        switch (inst->op) {
+                case IR_MOV:
+                        *val = a;
+                        return true;
+                case IR_SEXT:
+                        *val = inst->size == 1 ? (int8_t)a : inst->size == 2 ? (int16_t)a : (int32_t)a;
+                        return true;
+                case IR_EQ:
+                        *val = a == b;
+                        return true;
+                case IR_NE:
+                        *val = a != b;
+                        return true;
+                case IR_LT:
+                        *val = a < b;
+                        return true;
+                case IR_LE:
+                        *val = a <= b;
+                        return true;
+                case IR_ADD:
+                        x += y;
+                        break;
+                case IR_SUB:
+                        x -= y;
+                        break;
+                case IR_MUL:
+                        x *= y;
+                        break;
+                case IR_DIV:
+                case IR_MOD:
+                        if (b == 0 || b == -1)
+                                return false;
+                        x = inst->op == IR_DIV ? a / b : a % b;
+                        break;
+                case IR_AND:
+                        x &= y;
+                        break;
+                case IR_OR:
+                        x |= y;
+                        break;
+                case IR_XOR:
+                        x ^= y;
+                        break;
+                case IR_NEG:
+                        x = -x;
+                        break;
+                case IR_BITNOT:
+                        x = ~x;
+                        break;
+                default:
+                        return false;
+        }
+        *val = inst->size == 4 ? (int32_t)x : (int64_t)x;
+        return true;
+}
+
+static bool is_const(IRInst **def, int v) {
+        return v && def[v] && def[v]->op == IR_IMM;
+}
+
+static bool fold_inst(IRInst **def, IRInst *inst, int64_t *val) {
+        if (inst->op == IR_PHI) {
+                // A phi of one constant, apart from itself
+                bool found = false;
+                for (int i = 0; i < inst->nargs; i++) {
+                        int v = inst->args[i];
+                        if (v == inst->dst)
+                                continue;
+                        if (!is_const(def, v) || (found && def[v]->imm != *val))
+                                return false;
+                        *val = def[v]->imm;
+                        found = true;
+                }
+                return found;
+        }
+
+        if (!inst->dst || !is_const(def, inst->a))
+                return false;
+        if (inst->b && !is_const(def, inst->b))
+                return false;
+        return fold(inst, def[inst->a]->imm, inst->b ? def[inst->b]->imm : inst->imm, val);
+}
+
+static bool is_commutative(IROp op) {
+        return op == IR_ADD || op == IR_MUL || op == IR_AND || op == IR_OR ||
+                op == IR_XOR || op == IR_EQ || op == IR_NE;
+}
+
+static bool is_imm32_const(IRInst **def, int v) {
+        return is_const(def, v) && def[v]->imm == (int32_t)def[v]->imm;
+}
+
+// Folds constants and turns constant operands into immediates
+static void propagate_constants(IRFunc *func, IRInst **def) {
+        for (bool changed = true; changed;) {
+                changed = false;
+                for (IRBlock *block = func->blocks; block; block = block->next) {
+                        for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                                int64_t val;
+                                if (inst->op == IR_IMM || !fold_inst(def, inst, &val))
+                                        continue;
+                                *inst = (IRInst){.next = inst->next, .op = IR_IMM, .size = 8,
+                                        .file = inst->file, .line = inst->line, .dst = inst->dst, .imm = val};
+                                changed = true;
+                        }
+                }
+        }
+
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (inst->op == IR_STORE && is_imm32_const(def, inst->b)) {
+                                inst->imm = def[inst->b]->imm;
+                                inst->b = 0;
+                                continue;
+                        }
+
+                        // idiv has no immediate form
+                        if (inst->op < IR_ADD || inst->op > IR_LE || inst->op == IR_DIV ||
+                                        inst->op == IR_MOD || !inst->b)
+                                continue;
+                        if (is_commutative(inst->op) && is_const(def, inst->a) && !is_const(def, inst->b)) {
+                                int a = inst->a;
+                                inst->a = inst->b;
+                                inst->b = a;
+                        }
+                        if (is_imm32_const(def, inst->b)) {
+                                inst->imm = def[inst->b]->imm;
+                                inst->b = 0;
+                        }
+                }
+        }
+}
+
+static bool is_memory_access(IRInst *inst) {
+        return inst->op == IR_ADDR || inst->op == IR_LOAD || inst->op == IR_STORE || inst->op == IR_COPY;
+}
+
+// Folds the address arithmetic feeding a memory access into its
+// variable and offset. A version of a variable does not become the new
+// base, as that could make it outlive the next version.
+static void fold_addresses(IRFunc *func, IRInst **def) {
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (!is_memory_access(inst))
+                                continue;
+                        while (!inst->var && inst->a) {
+                                IRInst *base = def[inst->a];
+                                if (!base || func->version_of[base->a])
+                                        break;
+                                int64_t offset = inst->offset;
+                                if (base->op == IR_ADDR)
+                                        offset += base->offset;
+                                else if (base->op == IR_ADD && base->size == 8 && !base->b)
+                                        offset += base->imm;
+                                else
+                                        break;
+                                if (offset != (int32_t)offset)
+                                        break;
+                                inst->offset = offset;
+                                inst->var = base->op == IR_ADDR ? base->var : NULL;
+                                inst->a = base->a;
+                        }
+                }
+        }
+}
+
+// Deletes the instructions no side effect depends on
+static void eliminate_dead_code(IRFunc *func, IRInst **def) {
+        bool *live = calloc(func->vreg_count + 1, sizeof(bool));
+        IntList work = {};
+        int *buf[MAX_SLOTS];
+
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (!ir_has_side_effects(inst))
+                                continue;
+                        for (int i = 0, n = use_slots(inst, buf); i < n; i++) {
+                                if (!live[*buf[i]]) {
+                                        live[*buf[i]] = true;
+                                        push(&work, *buf[i]);
+                                }
+                        }
+                }
+        }
+
+        while (work.len) {
+                IRInst *inst = def[work.items[--work.len]];
+                if (!inst)
+                        continue;
+                int **slots = alloc_slots(inst, buf);
+                for (int i = 0, n = use_slots(inst, slots); i < n; i++) {
+                        if (!live[*slots[i]]) {
+                                live[*slots[i]] = true;
+                                push(&work, *slots[i]);
+                        }
+                }
+                if (slots != buf)
+                        free(slots);
+        }
+
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                IRInst head = {.next = block->insts};
+                IRInst *prev = &head;
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (ir_has_side_effects(inst) || live[inst->dst])
+                                prev = inst;
+                        else
+                                prev->next = inst->next;
+                }
+                block->insts = head.next;
+                block->last = prev == &head ? NULL : prev;
+        }
+
+        free(live);
+        free(work.items);
+}
+
+// Makes the instruction computing a temporary that is only copied to a
+// variable write the variable directly
+static void coalesce_copies(IRFunc *func) {
+        int *use_count = calloc(func->vreg_count + 1, sizeof(int));
+        int *buf[MAX_SLOTS];
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        int **slots = alloc_slots(inst, buf);
+                        for (int i = 0, n = use_slots(inst, slots); i < n; i++)
+                                use_count[*slots[i]]++;
+                        if (slots != buf)
+                                free(slots);
+                }
+        }
+
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                IRInst head = {.next = block->insts};
+                IRInst *prev = &head;
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (inst->op == IR_MOV && func->version_of[inst->dst] &&
+                                        !func->version_of[inst->a] && use_count[inst->a] == 1 &&
+                                        prev->dst == inst->a && prev->op != IR_PHI) {
+                                prev->dst = inst->dst;
+                                prev->next = inst->next;
+                                continue;
+                        }
+                        prev = inst;
+                }
+                block->insts = head.next;
+                block->last = prev == &head ? NULL : prev;
+        }
+        free(use_count);
+}
+
+void optimize_ir(IRFunc *func) {
+        IRInst **def = calloc(func->vreg_count + 1, sizeof(IRInst *));
+        for (IRBlock *block = func->blocks; block; block = block->next)
+                for (IRInst *inst = block->insts; inst; inst = inst->next)
+                        if (inst->dst)
+                                def[inst->dst] = inst;
+
+        propagate_constants(func, def);
+        fold_addresses(func, def);
+        eliminate_dead_code(func, def);
+        coalesce_copies(func);
+        free(def);
+}
+
+// Renames every version to the register of its variable and drops the
+// phis and the copies that became no-ops
+void leave_ssa(IRFunc *func) {
+        int *version_of = func->version_of;
+        for (IRBlock *block = func->blocks; block; block = block->next) {
+                IRInst head = {.next = block->insts};
+                IRInst *prev = &head;
+                for (IRInst *inst = block->insts; inst; inst = inst->next) {
+                        if (inst->op == IR_PHI) {
+                                prev->next = inst->next;
+                                continue;
+                        }
+
+                        int *slots[MAX_SLOTS];
+                        for (int i = 0, n = use_slots(inst, slots); i < n; i++)
+                                if (version_of[*slots[i]])
+                                        *slots[i] = version_of[*slots[i]];
+                        if (inst->op == IR_PARAMS) {
+                                for (int i = 0; i < inst->nargs; i++)
+                                        if (version_of[inst->args[i]])
+                                                inst->args[i] = version_of[inst->args[i]];
+                        } else if (inst->dst && version_of[inst->dst]) {
+                                inst->dst = version_of[inst->dst];
+                        }
+
+                        if (inst->op == IR_MOV && inst->dst == inst->a) {
+                                prev->next = inst->next;
+                                continue;
+                        }
+                        prev = inst;
+                }
+                block->insts = head.next;
+                block->last = prev == &head ? NULL : prev;
+        }
+}
@@ -0,0 +1,2624 @@
+.file 1 "/root/repo/test/arith.c"
+.file 2 "/root/repo/test/test.h"
+.file 3 "<scratch>"
+  .local .L..77
+  .section .rodata
+.L..77:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..76
+  .section .rodata
+.L..76:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..75
+  .section .rodata
+.L..75:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..74
+  .section .rodata
+.L..74:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..73
+  .section .rodata
+.L..73:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+  .local .L..72
+  .section .rodata
+.L..72:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..71
+  .section .rodata
+.L..71:
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 0
+  .local .L..70
+  .section .rodata
+.L..70:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..69
+  .section .rodata
+.L..69:
+  .byte 48
+  .byte 124
+  .byte 49
+  .byte 0
+  .local .L..68
+  .section .rodata
+.L..68:
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..67
+  .section .rodata
+.L..67:
+  .byte 55
+  .byte 38
+  .byte 51
+  .byte 0
+  .local .L..66
+  .section .rodata
+.L..66:
+  .byte 51
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..65
+  .section .rodata
+.L..65:
+  .byte 48
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..64
+  .section .rodata
+.L..64:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..63
+  .section .rodata
+.L..63:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..62
+  .section .rodata
+.L..62:
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 37
+  .byte 54
+  .byte 0
+  .local .L..61
+  .section .rodata
+.L..61:
+  .byte 49
+  .byte 55
+  .byte 37
+  .byte 54
+  .byte 0
+  .local .L..60
+  .section .rodata
+.L..60:
+  .byte 126
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..59
+  .section .rodata
+.L..59:
+  .byte 126
+  .byte 48
+  .byte 0
+  .local .L..58
+  .section .rodata
+.L..58:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..57
+  .section .rodata
+.L..57:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..56
+  .section .rodata
+.L..56:
+  .byte 33
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 51
+  .byte 0
+  .local .L..55
+  .section .rodata
+.L..55:
+  .byte 33
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 0
+  .local .L..54
+  .section .rodata
+.L..54:
+  .byte 33
+  .byte 48
+  .byte 0
+  .local .L..53
+  .section .rodata
+.L..53:
+  .byte 33
+  .byte 50
+  .byte 0
+  .local .L..52
+  .section .rodata
+.L..52:
+  .byte 33
+  .byte 49
+  .byte 0
+  .local .L..51
+  .section .rodata
+.L..51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .section .rodata
+.L..50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .section .rodata
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .section .rodata
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .section .rodata
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .section .rodata
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .section .rodata
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 41
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..44
+  .section .rodata
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .section .rodata
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .section .rodata
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .section .rodata
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..40
+  .section .rodata
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .section .rodata
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .section .rodata
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .section .rodata
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .section .rodata
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .section .rodata
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .section .rodata
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .section .rodata
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .section .rodata
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .section .rodata
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .section .rodata
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 49
+  .byte 48
+  .byte 55
+  .byte 51
+  .byte 55
+  .byte 52
+  .byte 49
+  .byte 56
+  .byte 50
+  .byte 52
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 50
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 48
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 49
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 48
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 48
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 53
+  .byte 49
+  .byte 32
+  .byte 33
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 48
+  .byte 32
+  .byte 33
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 53
+  .byte 49
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 49
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 48
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 51
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 50
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 53
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 57
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 53
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 54
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 55
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 53
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 52
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 53
+  .byte 49
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 48
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $144, %rsp
+.L.bb.main.0:
+ .loc 2 1
+ .loc 1 4
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..0(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 5
+  mov $51, %rcx
+  mov $51, %rsi
+  lea .L..1(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 6
+  mov $21, %rcx
+  mov $21, %rsi
+  lea .L..2(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 7
+  mov $41, %rcx
+  mov $41, %rsi
+  lea .L..3(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 8
+  mov $47, %rcx
+  mov $47, %rsi
+  lea .L..4(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 9
+  mov $15, %rcx
+  mov $15, %rsi
+  lea .L..5(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 10
+  mov $4, %rcx
+  mov $4, %rsi
+  lea .L..6(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 11
+  mov $10, %rcx
+  mov $10, %rsi
+  lea .L..7(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 12
+  mov $10, %rcx
+  mov $10, %rsi
+  lea .L..8(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 13
+  mov $10, %rcx
+  mov $10, %rsi
+  lea .L..9(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 15
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..10(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 16
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..11(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 17
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..12(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 18
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..13(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 20
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..14(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 21
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..15(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 22
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..16(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 23
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..17(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 24
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..18(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 25
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..19(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 27
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..20(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 28
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..21(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 29
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..22(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 30
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..23(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 31
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..24(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 32
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..25(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 34
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..26(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 36
+  mov $7, %rcx
+  mov $7, %rsi
+  lea .L..27(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 37
+  mov $7, %rcx
+  mov $7, %rsi
+  lea .L..28(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 38
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..29(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 39
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..30(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 40
+  mov $6, %rcx
+  mov $6, %rsi
+  lea .L..31(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 41
+  mov $6, %rcx
+  mov $6, %rsi
+  lea .L..32(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 42
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..33(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 43
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..34(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 45
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..35(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 46
+  mov $2, %rcx
+  movl $0, -144(%rbp)
+  movl $1, -140(%rbp)
+  movl $2, -136(%rbp)
+  mov -140(%rbp), %esi
+  add $1, %esi
+  mov %esi, -140(%rbp)
+  lea .L..36(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 47
+  xor %ecx, %ecx
+  movl $0, -132(%rbp)
+  movl $1, -128(%rbp)
+  movl $2, -124(%rbp)
+  mov -128(%rbp), %esi
+  sub $1, %esi
+  mov %esi, -128(%rbp)
+  lea .L..37(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 49
+  mov $2, %rcx
+  mov $2, %rsi
+  lea .L..38(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 50
+  mov $2, %rcx
+  mov $2, %rsi
+  lea .L..39(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 51
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..40(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 52
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..41(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 53
+  mov $1, %rcx
+  movl $0, -120(%rbp)
+  movl $1, -116(%rbp)
+  movl $2, -112(%rbp)
+  lea -120(%rbp), %rsi
+  add $4, %rsi
+  add $4, %rsi
+  mov -4(%rsi), %esi
+  lea .L..42(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 54
+  mov $1, %rcx
+  movl $0, -108(%rbp)
+  movl $1, -104(%rbp)
+  movl $2, -100(%rbp)
+  lea -108(%rbp), %rsi
+  add $4, %rsi
+  add $-4, %rsi
+  mov 4(%rsi), %esi
+  lea .L..43(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 56
+  xor %ecx, %ecx
+  movl $0, -96(%rbp)
+  movl $1, -92(%rbp)
+  movl $2, -88(%rbp)
+  lea -96(%rbp), %rsi
+  add $4, %rsi
+  add $4, %rsi
+  mov -4(%rsi), %edi
+  add $-1, %edi
+  mov %edi, -4(%rsi)
+  mov -96(%rbp), %esi
+  lea .L..44(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 57
+  xor %ecx, %ecx
+  movl $0, -84(%rbp)
+  movl $1, -80(%rbp)
+  movl $2, -76(%rbp)
+  lea -84(%rbp), %rsi
+  add $4, %rsi
+  add $-4, %rsi
+  mov 4(%rsi), %edi
+  add $-1, %edi
+  mov %edi, 4(%rsi)
+  mov -80(%rbp), %esi
+  lea .L..45(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 58
+  mov $2, %rcx
+  movl $0, -72(%rbp)
+  movl $1, -68(%rbp)
+  movl $2, -64(%rbp)
+  mov -68(%rbp), %esi
+  add $-1, %esi
+  mov %esi, -68(%rbp)
+  mov -64(%rbp), %esi
+  lea .L..46(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 59
+  mov $2, %rcx
+  movl $0, -60(%rbp)
+  movl $1, -56(%rbp)
+  movl $2, -52(%rbp)
+  lea -60(%rbp), %rsi
+  add $4, %rsi
+  mov -56(%rbp), %edi
+  add $-1, %edi
+  mov %edi, -56(%rbp)
+  add $4, %rsi
+  mov 0(%rsi), %esi
+  lea .L..47(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 61
+  xor %ecx, %ecx
+  movl $0, -48(%rbp)
+  movl $1, -44(%rbp)
+  movl $2, -40(%rbp)
+  lea -48(%rbp), %rsi
+  add $4, %rsi
+  add $4, %rsi
+  mov -4(%rsi), %edi
+  add $-1, %edi
+  mov %edi, -4(%rsi)
+  mov -48(%rbp), %esi
+  lea .L..48(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 62
+  xor %ecx, %ecx
+  movl $0, -36(%rbp)
+  movl $1, -32(%rbp)
+  movl $2, -28(%rbp)
+  lea -36(%rbp), %rsi
+  add $4, %rsi
+  add $4, %rsi
+  mov -4(%rsi), %edi
+  add $-1, %edi
+  mov %edi, -4(%rsi)
+  mov -32(%rbp), %esi
+  lea .L..49(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 63
+  mov $2, %rcx
+  movl $0, -24(%rbp)
+  movl $1, -20(%rbp)
+  movl $2, -16(%rbp)
+  lea -24(%rbp), %rsi
+  add $4, %rsi
+  add $4, %rsi
+  mov -4(%rsi), %edi
+  add $-1, %edi
+  mov %edi, -4(%rsi)
+  mov -16(%rbp), %esi
+  lea .L..50(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 64
+  mov $2, %rcx
+  movl $0, -12(%rbp)
+  movl $1, -8(%rbp)
+  movl $2, -4(%rbp)
+  lea -12(%rbp), %rsi
+  add $4, %rsi
+  mov %rsi, %rdi
+  add $4, %rdi
+  mov %rdi, %rsi
+  mov -4(%rdi), %r8d
+  add $-1, %r8d
+  mov %r8d, -4(%rdi)
+  mov 0(%rsi), %esi
+  lea .L..51(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 66
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..52(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 67
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..53(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 68
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..54(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 69
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..55(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 70
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..56(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 71
+  mov $4, %rcx
+  mov $4, %rsi
+  lea .L..57(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 72
+  mov $4, %rcx
+  mov $4, %rsi
+  lea .L..58(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 74
+  mov $-1, %rcx
+  mov $-1, %rsi
+  lea .L..59(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 75
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..60(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 77
+  mov $5, %rcx
+  mov $5, %rsi
+  lea .L..61(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 78
+  mov $5, %rcx
+  mov $5, %rsi
+  lea .L..62(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 79
+  mov $2, %rcx
+  mov $2, %rsi
+  lea .L..63(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 80
+  mov $2, %rcx
+  mov $2, %rsi
+  lea .L..64(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 82
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..65(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 83
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..66(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 84
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..67(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 85
+  mov $10, %rcx
+  mov $10, %rsi
+  lea .L..68(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 87
+  mov $1, %rcx
+  mov $1, %rsi
+  lea .L..69(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 88
+  mov $19, %rcx
+  mov $19, %rsi
+  lea .L..70(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 90
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..71(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 91
+  xor %ecx, %ecx
+  xor %esi, %esi
+  lea .L..72(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 92
+  mov $52, %rcx
+  mov $52, %rsi
+  lea .L..73(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 94
+  mov $2, %rcx
+  mov $2, %rsi
+  lea .L..74(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 95
+  mov $7, %rcx
+  mov $7, %rsi
+  lea .L..75(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 96
+  mov $10, %rcx
+  mov $10, %rsi
+  lea .L..76(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 98
+  lea .L..77(%rip), %rcx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call printf
+  mov %rax, %rcx
+ .loc 1 99
+  xor %ecx, %ecx
+  mov %rcx, %rax
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
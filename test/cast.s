@@ -0,0 +1,406 @@
+.file 1 "test/cast.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $131585, %rax
+  push %rax
+ .loc 1 4
+  mov $131585, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $513, %rax
+  push %rax
+ .loc 1 5
+  mov $513, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $1, %rax
+  push %rax
+ .loc 1 6
+  mov $1, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $1, %rax
+  push %rax
+ .loc 1 7
+  mov $1, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $0, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  mov $0, %rax
+  movsxd %eax, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 9
+  mov $513, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -16(%rbp), %rax
+  push %rax
+ .loc 1 9
+  mov $512, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -16(%rbp), %rax
+  push %rax
+ .loc 1 9
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 9
+ .loc 1 9
+  lea -16(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 9
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $5, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -12(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -8(%rbp), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -12(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $1, %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 15
+ .loc 1 15
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
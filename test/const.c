@@ -0,0 +1,29 @@
+#include "test.h"
+
+int global_array[2 * 3 + 1];
+
+int main() {
+        ASSERT(10, 2 * 3 + 4);
+        ASSERT(2, 17 / 5 - 1);
+        ASSERT(2, 17 % 5);
+        ASSERT(-7, -(3 + 4));
+        ASSERT(1, 3 < 4 && 5 >= 5);
+        ASSERT(0, 3 > 4 || 0);
+        ASSERT(2, 3 & 6 | 2 ^ 0);
+        ASSERT(-1, ~0);
+        ASSERT(1, !0);
+        ASSERT(44, (char)300);
+        ASSERT(1, (_Bool)256);
+        ASSERT(0, 2147483647 + 1 > 0);
+        ASSERT(24, ({ int x[2 * 3]; sizeof(x); }));
+        ASSERT(64, ({ char x[sizeof(int) * 4][4]; sizeof(x); }));
+        ASSERT(28, sizeof(global_array));
+        ASSERT(7, ({ enum { seven = 1 + 2 * 3 }; seven; }));
+        ASSERT(8, ({ enum { seven = 1 + 2 * 3, eight }; eight; }));
+        ASSERT(10, ({ enum { two = 2, ten = two * 5 }; ten; }));
+        ASSERT(16, ({ enum { size = sizeof(long) * 2 }; size; }));
+        ASSERT(12, ({ int x[3]; enum { n = sizeof(x) / sizeof(x[0]) }; n * 4; }));
+
+        printf("\nEVERYTHING GOOD\n");
+        return 0;
+}
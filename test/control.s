@@ -0,0 +1,1797 @@
+.file 1 "test/control.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 59
+  .byte 59
+  .byte 59
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 54
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $80, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $3, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  mov $0, %rax
+  cmp $0, %rax
+  je  .L.else.main.1
+ .loc 1 4
+ .loc 1 4
+  lea -76(%rbp), %rax
+  push %rax
+ .loc 1 4
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.end.main.1
+.L.else.main.1:
+ .loc 1 4
+ .loc 1 4
+  lea -76(%rbp), %rax
+  push %rax
+ .loc 1 4
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.end.main.1:
+ .loc 1 4
+ .loc 1 4
+  lea -76(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $3, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  mov $0, %rax
+  cmp $0, %rax
+  je  .L.else.main.2
+ .loc 1 5
+ .loc 1 5
+  lea -72(%rbp), %rax
+  push %rax
+ .loc 1 5
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.end.main.2
+.L.else.main.2:
+.L.end.main.2:
+ .loc 1 5
+ .loc 1 5
+  lea -72(%rbp), %rax
+  push %rax
+ .loc 1 5
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+  lea -72(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $69, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  mov $1, %rax
+  cmp $0, %rax
+  je  .L.else.main.3
+ .loc 1 7
+ .loc 1 7
+  lea -68(%rbp), %rax
+  push %rax
+ .loc 1 7
+  mov $69, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.end.main.3
+.L.else.main.3:
+ .loc 1 7
+ .loc 1 7
+  lea -68(%rbp), %rax
+  push %rax
+ .loc 1 7
+  mov $64, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.end.main.3:
+ .loc 1 7
+ .loc 1 7
+  lea -68(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $69, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  mov $1, %rax
+  cmp $0, %rax
+  je  .L.else.main.4
+ .loc 1 8
+ .loc 1 8
+  lea -64(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $69, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.end.main.4
+.L.else.main.4:
+ .loc 1 8
+ .loc 1 8
+  lea -64(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $64, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.end.main.4:
+ .loc 1 8
+ .loc 1 8
+  lea -64(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $55, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -60(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -56(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -60(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.begin.main.5:
+ .loc 1 10
+ .loc 1 10
+  mov $10, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -60(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.5
+ .loc 1 10
+ .loc 1 10
+  lea -56(%rbp), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -56(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -60(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+  lea -60(%rbp), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  mov $1, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -60(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.5
+.L.end.main.5:
+ .loc 1 10
+ .loc 1 10
+  lea -56(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 12
+  mov $6, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  lea -52(%rbp), %rax
+  push %rax
+ .loc 1 12
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 12
+.L.begin.main.6:
+ .loc 1 12
+ .loc 1 12
+  mov $6, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -52(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setl %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.6
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  lea -52(%rbp), %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $1, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -52(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.6
+.L.end.main.6:
+ .loc 1 12
+ .loc 1 12
+  lea -52(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 12
+ .loc 2 1
+ .loc 2 1
+ .loc 1 14
+  mov $3, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  mov $1, %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  mov $2, %rax
+ .loc 1 14
+ .loc 1 14
+  mov $3, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 14
+ .loc 2 1
+ .loc 2 1
+ .loc 1 15
+  mov $5, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  mov $5, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 15
+ .loc 2 1
+ .loc 2 1
+ .loc 1 17
+  mov $10, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -48(%rbp), %rax
+  push %rax
+ .loc 1 17
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 17
+.L.begin.main.7:
+ .loc 1 17
+ .loc 1 17
+  mov $10, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea -48(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setl %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.7
+ .loc 1 17
+ .loc 1 17
+  lea -48(%rbp), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  mov $1, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea -48(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.7
+.L.end.main.7:
+ .loc 1 17
+ .loc 1 17
+  lea -48(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 17
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $55, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -44(%rbp), %rax
+  push %rax
+ .loc 1 18
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -40(%rbp), %rax
+  push %rax
+ .loc 1 18
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+.L.begin.main.8:
+ .loc 1 18
+ .loc 1 18
+  mov $10, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea -44(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.8
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -40(%rbp), %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -40(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea -44(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+ .loc 1 18
+  lea -44(%rbp), %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  mov $1, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea -44(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.8
+.L.end.main.8:
+ .loc 1 18
+ .loc 1 18
+  lea -40(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $3, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $1, %rax
+ .loc 1 20
+ .loc 1 20
+  mov $2, %rax
+ .loc 1 20
+  mov $3, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 21
+  mov $5, %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  lea -36(%rbp), %rax
+  push %rax
+ .loc 1 21
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 21
+ .loc 1 21
+  lea -32(%rbp), %rax
+  push %rax
+ .loc 1 21
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  lea -36(%rbp), %rax
+  push %rax
+ .loc 1 21
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  lea -32(%rbp), %rax
+  push %rax
+ .loc 1 21
+  mov $6, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 21
+ .loc 1 21
+  lea -36(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 21
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $6, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -28(%rbp), %rax
+  push %rax
+ .loc 1 22
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+  lea -24(%rbp), %rax
+  push %rax
+ .loc 1 22
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -28(%rbp), %rax
+  push %rax
+ .loc 1 22
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  lea -24(%rbp), %rax
+  push %rax
+ .loc 1 22
+  mov $6, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+  lea -24(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 24
+  mov $55, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  lea -20(%rbp), %rax
+  push %rax
+ .loc 1 24
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  lea -16(%rbp), %rax
+  push %rax
+ .loc 1 24
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.begin.main.9:
+ .loc 1 24
+ .loc 1 24
+  mov $10, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea -16(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.9
+ .loc 1 24
+ .loc 1 24
+  lea -20(%rbp), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  lea -16(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea -20(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 24
+  lea -16(%rbp), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  mov $1, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea -16(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.9
+.L.end.main.9:
+ .loc 1 24
+ .loc 1 24
+  lea -20(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 24
+ .loc 2 1
+ .loc 2 1
+ .loc 1 25
+  mov $3, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -12(%rbp), %rax
+  push %rax
+ .loc 1 25
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -8(%rbp), %rax
+  push %rax
+ .loc 1 25
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -4(%rbp), %rax
+  push %rax
+ .loc 1 25
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+.L.begin.main.10:
+ .loc 1 25
+ .loc 1 25
+  mov $10, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.end.main.10
+ .loc 1 25
+ .loc 1 25
+  lea -8(%rbp), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -8(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 25
+  lea -4(%rbp), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  mov $1, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+ mov %eax, (%rdi)
+  jmp .L.begin.main.10
+.L.end.main.10:
+ .loc 1 25
+ .loc 1 25
+  lea -12(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 25
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $1, %rax
+  push %rax
+ .loc 1 27
+  mov $1, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $1, %rax
+  push %rax
+ .loc 1 28
+  mov $1, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 29
+  mov $0, %rax
+  push %rax
+ .loc 1 29
+  mov $0, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 29
+ .loc 2 1
+ .loc 2 1
+ .loc 1 30
+  mov $0, %rax
+  push %rax
+ .loc 1 30
+  mov $0, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 30
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $0, %rax
+  push %rax
+ .loc 1 32
+  mov $0, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 33
+  mov $0, %rax
+  push %rax
+ .loc 1 33
+  mov $0, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 33
+ .loc 2 1
+ .loc 2 1
+ .loc 1 34
+  mov $1, %rax
+  push %rax
+ .loc 1 34
+  mov $1, %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 34
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 37
+ .loc 1 37
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
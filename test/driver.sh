@@ -23,6 +23,279 @@ rm -f $tmp/out
 [ -f $tmp/out ]
 check -o
 
+# line numbers in diagnostics
+printf 'int main() {\n/*\n*/ return y;\n}\n' > $tmp/err.c
+./main -o $tmp/out $tmp/err.c 2>&1 | grep -q 'err.c:3: '
+check 'line numbers'
+
+# vectorized and scalar lexer scanners agree
+cat > $tmp/scan.c <<'EOF2'
+/* a block comment
+ * spanning ** several lines */
+int a_rather_long_identifier_name_that_spans_blocks; // trailing
+int main() {
+		a_rather_long_identifier_name_that_spans_blocks = 3;
+		char *s = "escaped \" quote and \\ backslash";
+	  	return a_rather_long_identifier_name_that_spans_blocks + s[0];
+}
+EOF2
+for isa in scalar sse2 avx2; do
+        SCAN_ISA=$isa ./main -o $tmp/scan-$isa.s $tmp/scan.c || exit 1
+done
+cmp -s $tmp/scan-scalar.s $tmp/scan-sse2.s && cmp -s $tmp/scan-scalar.s $tmp/scan-avx2.s
+check 'SIMD scanners'
+
+# --mem-stats
+./main --mem-stats -o $tmp/out $tmp/empty.c 2>&1 | grep -q '^tokens '
+check --mem-stats
+
+# Derived types are interned
+echo 'int main() { int *p; int *q; int **r; int a[3]; int b[3]; return 0; }' > $tmp/types.c
+./main --mem-stats -o $tmp/out $tmp/types.c 2>&1 | grep -q '^typetab  *3 types'
+check 'type interning'
+
+# -E
+printf '#define ADD(x, y) x + y\nADD(1, 2)\n' > $tmp/pp.c
+./main -E $tmp/pp.c | grep -q '^1 + 2$'
+check -E
+
+# Stringizing escapes backslashes only in literals
+printf '#define S(x) #x\nS("a\\\\b" x\\y)\n' > $tmp/str.c
+./main -E $tmp/str.c | grep -qF '"\"a\\\\b\" x\y"'
+check 'stringize'
+
+# Tokens made by ## are on the line of the macro call
+printf '#define CAT(x, y) x##y\n\nint f() { return CAT(und, ef); }\n' > $tmp/paste.c
+./main -o $tmp/out $tmp/paste.c 2>&1 | grep -q 'paste.c:3: '
+check 'pasted token line'
+
+# Code from a header is credited to the header in the debug line table
+mkdir -p $tmp/loc
+printf 'int x;\n\nint h() {\n  return 3;\n}\n' > $tmp/loc/h.h
+printf '#include "h.h"\nint main() { return h(); }\n' > $tmp/loc/l.c
+failed=
+for level in 0 1; do
+        ./main -O$level -o $tmp/loc.s $tmp/loc/l.c &&
+                grep -q '^.file 2 ".*/h.h"$' $tmp/loc.s && grep -q '^ .loc 2 4$' $tmp/loc.s || failed=-O$level
+done
+[ -z "$failed" ]
+check ".loc in headers${failed:+ at $failed}"
+
+# -I and include guards
+mkdir -p $tmp/inc
+printf '#ifndef GUARD_H\n#define GUARD_H\nint guarded;\n#endif\n' > $tmp/inc/guard.h
+printf '#include "guard.h"\n#include <guard.h>\n' > $tmp/guard.c
+[ "`./main -E -I $tmp/inc $tmp/guard.c | grep -c guarded`" = 1 ]
+check 'include guard'
+
+# --emit-pch and --include-pch
+cat > $tmp/prelude.h <<EOF2
+typedef struct point { struct point *next; int x; int y; } Point;
+enum color { RED, GREEN = 5, BLUE };
+int add(int a, int b);
+typedef Point *PointPtr;
+EOF2
+cat > $tmp/pch.c <<EOF2
+int add(int a, int b) { return a + b; }
+int main() {
+        Point p;
+        PointPtr q = &p;
+        struct point r;
+        q->next = &r;
+        q->next->x = BLUE;
+        p.y = GREEN;
+        return add(r.x, p.y) + sizeof(r) - 27;
+}
+EOF2
+./main --emit-pch -o $tmp/prelude.pch $tmp/prelude.h &&
+        ./main --include-pch $tmp/prelude.pch -o $tmp/pch.s $tmp/pch.c &&
+        gcc -o $tmp/pch $tmp/pch.s 2>/dev/null && $tmp/pch
+check 'precompiled header'
+
+# Several inputs compiled by a pool of threads
+for i in 1 2 3; do
+        echo "int main() { return $i; }" > $tmp/batch$i.c
+done
+./main -j 2 $tmp/batch1.c $tmp/batch2.c $tmp/batch3.c &&
+        gcc -o $tmp/batch2 $tmp/batch2.s 2>/dev/null && $tmp/batch2
+[ $? = 2 ] && [ -f $tmp/batch1.s ] && [ -f $tmp/batch3.s ]
+check '-j'
+
+# Files of a batch that include the same header share its cached tokens
+mkdir -p $tmp/shared
+cat > $tmp/shared/s.h <<EOF2
+#pragma once
+#define TWICE(x) ((x) * 2)
+int first() { return "hello"[0]; }
+EOF2
+for i in 1 2 3 4; do
+        printf '#include "s.h"\n#include "s.h"\nint main() { return TWICE(%d) + first() - 104; }\n' $i > $tmp/shared/s$i.c
+done
+failed=
+./main -j 4 $tmp/shared/s1.c $tmp/shared/s2.c $tmp/shared/s3.c $tmp/shared/s4.c || failed=-j
+for i in 1 2 3 4; do
+        ./main -o $tmp/shared/one$i.s $tmp/shared/s$i.c &&
+                cmp -s $tmp/shared/s$i.s $tmp/shared/one$i.s || failed=s$i.c
+done
+gcc -o $tmp/shared/s3 $tmp/shared/s3.s 2>/dev/null && $tmp/shared/s3
+[ $? = 6 ] && [ -z "$failed" ]
+check "-j ${failed:-with a shared header}"
+
+# Functions generated on several threads come out in source order
+./main -j 1 -I test -o $tmp/serial.s test/control.c &&
+        ./main -j 4 -I test -o $tmp/parallel.s test/control.c &&
+        cmp -s $tmp/serial.s $tmp/parallel.s
+check 'parallel codegen'
+
+# Output that is written out in several chunks is the same to a file,
+# to stdout and from several threads
+for i in `seq 2000`; do echo "int f$i(int x) { return x * $i + f$i(x - 1); }"; done > $tmp/big.c
+./main -o $tmp/big.s $tmp/big.c &&
+        ./main -o - $tmp/big.c | cmp -s - $tmp/big.s &&
+        ./main -j 4 -o $tmp/big4.s $tmp/big.c && cmp -s $tmp/big.s $tmp/big4.s &&
+        [ `wc -c < $tmp/big.s` -gt 200000 ]
+check 'chunked output'
+
+# --pipeline
+./main --pipeline -I test -o $tmp/pipeline.s test/control.c &&
+        gcc -o $tmp/pipeline $tmp/pipeline.s -xc test/common 2>/dev/null && $tmp/pipeline > /dev/null
+check --pipeline
+
+# --stream frees every function's AST once it is written out
+./main --stream -I test -o $tmp/stream.s test/control.c &&
+        gcc -o $tmp/stream $tmp/stream.s -xc test/common 2>/dev/null && $tmp/stream > /dev/null &&
+        ./main --stream --mem-stats -I test -o $tmp/stream.s test/control.c 2>&1 | grep -q '^ast  *0 bytes used'
+check --stream
+
+# --lazy-bodies parses only the bodies that are needed
+cat > $tmp/lazy.c <<EOF2
+static int unused(int x) { return x * 2; }
+static int late();
+static int helper2(int x) { return x + 1; }
+static int helper(int x) { return helper2(x) * 2; }
+int main() { return helper(1) + late(); }
+static int late() { return 3; }
+EOF2
+./main --lazy-bodies -o $tmp/lazy.s $tmp/lazy.c && gcc -o $tmp/lazy $tmp/lazy.s 2>/dev/null
+$tmp/lazy
+[ $? = 7 ] && ! grep -q unused $tmp/lazy.s
+check --lazy-bodies
+
+# A deferred body only sees what was declared before it
+echo 'int f() { return x; } int x;' > $tmp/lazyscope.c
+./main --lazy-bodies -o $tmp/lazy.s $tmp/lazyscope.c 2>&1 | grep -q 'undefined variable'
+check '--lazy-bodies scope'
+
+# Constant expressions are folded at compile time
+echo 'int main() { return 2 * 3 + 4; }' > $tmp/fold.c
+./main -o - $tmp/fold.c | grep -q 'mov \$10, %rax' && ! ./main -o - $tmp/fold.c | grep -q imul
+check 'constant folding'
+
+# -O1 passes the feature tests. pointer.c is left out because it looks
+# at where neighbouring variables are in memory.
+failed=
+for f in test/*.c; do
+        case $f in
+                test/testfile.c|test/pointer.c)
+                        continue
+                        ;;
+        esac
+        ./main -O1 -I test -o $tmp/opt.s $f &&
+                gcc -o $tmp/opt $tmp/opt.s -xc test/common 2>/dev/null &&
+                $tmp/opt | tail -1 | grep -q 'EVERYTHING GOOD' || failed=$f
+done
+[ -z "$failed" ]
+check "-O1 ${failed:-feature tests}"
+
+# -O1 generates functions on threads and while parsing the same way
+failed=
+for mode in '-j 4' --stream --pipeline; do
+        ./main -O1 $mode -I test -o $tmp/opt.s test/control.c &&
+                gcc -o $tmp/opt $tmp/opt.s -xc test/common 2>/dev/null &&
+                $tmp/opt > /dev/null || failed=$mode
+done
+[ -z "$failed" ]
+check "-O1 ${failed:-with -j, --stream and --pipeline}"
+
+# -c assembles the feature tests into objects gcc links without
+# complaint, at -O0 and at -O1
+failed=
+for level in 0 1; do
+        for f in test/*.c; do
+                case $level$f in
+                        *test/testfile.c|1test/pointer.c)
+                                continue
+                                ;;
+                esac
+                ./main -O$level -c -I test -o $tmp/obj.o $f &&
+                        gcc -o $tmp/obj $tmp/obj.o -xc test/common > $tmp/obj.log 2>&1 && [ ! -s $tmp/obj.log ] &&
+                        $tmp/obj | tail -1 | grep -q 'EVERYTHING GOOD' || failed="-O$level $f"
+        done
+done
+[ -z "$failed" ]
+check "-c ${failed:-feature tests}"
+
+# -c without -o names the object after the source
+echo 'int main() { return 7; }' > $tmp/seven.c
+main=`pwd`/main
+(cd $tmp && $main -c seven.c) && gcc -o $tmp/seven $tmp/seven.o && $tmp/seven
+[ $? = 7 ]
+check '-c object name'
+
+# --run executes the feature tests in memory, with test/common built
+# once as a shared library
+gcc -shared -fPIC -o $tmp/common.so -xc test/common
+failed=
+for level in 0 1; do
+        for f in test/*.c; do
+                case $level$f in
+                        *test/testfile.c|1test/pointer.c)
+                                continue
+                                ;;
+                esac
+                ./main -O$level --run --load $tmp/common.so -I test $f | tail -1 | grep -q 'EVERYTHING GOOD' ||
+                        failed="-O$level $f"
+        done
+done
+[ -z "$failed" ]
+check "--run ${failed:-feature tests}"
+
+# The program gets its arguments and its exit status is main's result
+cat > $tmp/args.c <<EOF2
+int printf();
+int main(int argc, char **argv) { printf("%s\n", argv[2]); return argc; }
+EOF2
+[ "`./main --run $tmp/args.c -- one two; echo $?`" = "two
+3" ]
+check '--run arguments'
+
+# The peephole optimizer keeps the -O0 code working and removes
+# push/pop pairs from it
+failed=
+for f in test/*.c; do
+        [ $f = test/testfile.c ] && continue
+        ./main -O0 --peephole -I test -o $tmp/peep.s $f &&
+                gcc -o $tmp/peep $tmp/peep.s -xc test/common 2>/dev/null &&
+                $tmp/peep | tail -1 | grep -q 'EVERYTHING GOOD' || failed=$f
+done
+[ -z "$failed" ]
+check "--peephole ${failed:-feature tests}"
+
+echo 'int main() { int x = 3; if (x + 2 * x < 10) return x; return 0; }' > $tmp/peep.c
+./main -O0 --peephole --peephole-stats -o $tmp/peep.s $tmp/peep.c 2> $tmp/peep.stats &&
+        ./main -O0 -o $tmp/plain.s $tmp/peep.c &&
+        [ `grep -c pop $tmp/peep.s` -lt `grep -c pop $tmp/plain.s` ] &&
+        awk '$1 == "push-pop" && $2 > 0 { found = 1 } END { exit !found }' $tmp/peep.stats
+check --peephole-stats
+
+# --emit=ir promotes locals to SSA values with phis
+cat > $tmp/ssa.c <<EOF2
+int sum(int n) { int s = 0; for (int i = 0; i < n; i++) s = s + i; return s; }
+EOF2
+./main --emit=ir -o $tmp/ssa.ir $tmp/ssa.c &&
+        grep -q '= phi ' $tmp/ssa.ir && ! grep -q 'load\|store' $tmp/ssa.ir
+check --emit=ir
+
 # -- help
 ./main --help 2>&1 | grep -q main
 check --help
@@ -0,0 +1,1867 @@
+.file 1 "test/function.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 117
+  .byte 110
+  .byte 99
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 50
+  .byte 54
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 50
+  .byte 54
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 44
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 41
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 0
+  .globl g1
+  .bss
+g1:
+  .zero 4
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 59
+  mov $3, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  mov $0, %rax
+  call ret3
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 59
+ .loc 2 1
+ .loc 2 1
+ .loc 1 60
+  mov $8, %rax
+  push %rax
+ .loc 1 60
+ .loc 1 60
+ .loc 1 60
+  mov $3, %rax
+  push %rax
+ .loc 1 60
+  mov $5, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add2
+  push %rax
+ .loc 1 60
+ .loc 1 60
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 60
+ .loc 2 1
+ .loc 2 1
+ .loc 1 61
+  mov $2, %rax
+  push %rax
+ .loc 1 61
+ .loc 1 61
+ .loc 1 61
+  mov $5, %rax
+  push %rax
+ .loc 1 61
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub2
+  push %rax
+ .loc 1 61
+ .loc 1 61
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 61
+ .loc 2 1
+ .loc 2 1
+ .loc 1 62
+  mov $21, %rax
+  push %rax
+ .loc 1 62
+ .loc 1 62
+ .loc 1 62
+  mov $1, %rax
+  push %rax
+ .loc 1 62
+  mov $2, %rax
+  push %rax
+ .loc 1 62
+  mov $3, %rax
+  push %rax
+ .loc 1 62
+  mov $4, %rax
+  push %rax
+ .loc 1 62
+  mov $5, %rax
+  push %rax
+ .loc 1 62
+  mov $6, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 62
+ .loc 1 62
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 62
+ .loc 2 1
+ .loc 2 1
+ .loc 1 63
+  mov $66, %rax
+  push %rax
+ .loc 1 63
+ .loc 1 63
+ .loc 1 63
+  mov $1, %rax
+  push %rax
+ .loc 1 63
+  mov $2, %rax
+  push %rax
+ .loc 1 63
+ .loc 1 63
+ .loc 1 63
+  mov $3, %rax
+  push %rax
+ .loc 1 63
+  mov $4, %rax
+  push %rax
+ .loc 1 63
+  mov $5, %rax
+  push %rax
+ .loc 1 63
+  mov $6, %rax
+  push %rax
+ .loc 1 63
+  mov $7, %rax
+  push %rax
+ .loc 1 63
+  mov $8, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 63
+  mov $9, %rax
+  push %rax
+ .loc 1 63
+  mov $10, %rax
+  push %rax
+ .loc 1 63
+  mov $11, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 63
+ .loc 1 63
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 63
+ .loc 2 1
+ .loc 2 1
+ .loc 1 64
+  mov $136, %rax
+  push %rax
+ .loc 1 64
+ .loc 1 64
+ .loc 1 64
+  mov $1, %rax
+  push %rax
+ .loc 1 64
+  mov $2, %rax
+  push %rax
+ .loc 1 64
+ .loc 1 64
+ .loc 1 64
+  mov $3, %rax
+  push %rax
+ .loc 1 64
+ .loc 1 64
+ .loc 1 64
+  mov $4, %rax
+  push %rax
+ .loc 1 64
+  mov $5, %rax
+  push %rax
+ .loc 1 64
+  mov $6, %rax
+  push %rax
+ .loc 1 64
+  mov $7, %rax
+  push %rax
+ .loc 1 64
+  mov $8, %rax
+  push %rax
+ .loc 1 64
+  mov $9, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 64
+  mov $10, %rax
+  push %rax
+ .loc 1 64
+  mov $11, %rax
+  push %rax
+ .loc 1 64
+  mov $12, %rax
+  push %rax
+ .loc 1 64
+  mov $13, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 64
+  mov $14, %rax
+  push %rax
+ .loc 1 64
+  mov $15, %rax
+  push %rax
+ .loc 1 64
+  mov $16, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+ .loc 1 64
+ .loc 1 64
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 64
+ .loc 2 1
+ .loc 2 1
+ .loc 1 66
+  mov $7, %rax
+  push %rax
+ .loc 1 66
+ .loc 1 66
+ .loc 1 66
+  mov $3, %rax
+  push %rax
+ .loc 1 66
+  mov $4, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add2
+  push %rax
+ .loc 1 66
+ .loc 1 66
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 66
+ .loc 2 1
+ .loc 2 1
+ .loc 1 67
+  mov $1, %rax
+  push %rax
+ .loc 1 67
+ .loc 1 67
+ .loc 1 67
+  mov $4, %rax
+  push %rax
+ .loc 1 67
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub2
+  push %rax
+ .loc 1 67
+ .loc 1 67
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 67
+ .loc 2 1
+ .loc 2 1
+ .loc 1 68
+  mov $55, %rax
+  push %rax
+ .loc 1 68
+ .loc 1 68
+ .loc 1 68
+  mov $9, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  push %rax
+ .loc 1 68
+ .loc 1 68
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 68
+ .loc 2 1
+ .loc 2 1
+ .loc 1 70
+  mov $1, %rax
+  push %rax
+ .loc 1 70
+ .loc 1 70
+ .loc 1 70
+ .loc 1 70
+ .loc 1 70
+  mov $7, %rax
+  push %rax
+ .loc 1 70
+  mov $3, %rax
+  push %rax
+ .loc 1 70
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_char
+  push %rax
+ .loc 1 70
+ .loc 1 70
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 70
+ .loc 2 1
+ .loc 2 1
+ .loc 1 72
+  mov $1, %rax
+  push %rax
+ .loc 1 72
+ .loc 1 72
+ .loc 1 72
+  mov $7, %rax
+  push %rax
+ .loc 1 72
+  mov $3, %rax
+  push %rax
+ .loc 1 72
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_long
+  push %rax
+ .loc 1 72
+ .loc 1 72
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 72
+ .loc 2 1
+ .loc 2 1
+ .loc 1 73
+  mov $1, %rax
+  push %rax
+ .loc 1 73
+ .loc 1 73
+ .loc 1 73
+  mov $7, %rax
+  push %rax
+ .loc 1 73
+  mov $3, %rax
+  push %rax
+ .loc 1 73
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_short
+  push %rax
+ .loc 1 73
+ .loc 1 73
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 73
+ .loc 1 75
+ .loc 1 75
+  lea g1(%rip), %rax
+  push %rax
+ .loc 1 75
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 2 1
+ .loc 2 1
+ .loc 1 77
+  mov $3, %rax
+  push %rax
+ .loc 1 77
+ .loc 1 77
+ .loc 1 77
+  mov $0, %rax
+  call g1_ptr
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 77
+ .loc 1 77
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 77
+ .loc 2 1
+ .loc 2 1
+ .loc 1 78
+  mov $5, %rax
+  push %rax
+ .loc 1 78
+ .loc 1 78
+ .loc 1 78
+  mov $261, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call int_to_char
+  push %rax
+ .loc 1 78
+ .loc 1 78
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 78
+ .loc 2 1
+ .loc 2 1
+ .loc 1 79
+  mov $5, %rax
+  push %rax
+ .loc 1 79
+ .loc 1 79
+ .loc 1 79
+  mov $261, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call int_to_char
+  push %rax
+ .loc 1 79
+ .loc 1 79
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 79
+ .loc 2 1
+ .loc 2 1
+ .loc 1 80
+  mov $-5, %rax
+  push %rax
+ .loc 1 80
+ .loc 1 80
+ .loc 1 80
+  mov $-10, %rax
+  push %rax
+ .loc 1 80
+  mov $2, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call div_long
+  push %rax
+ .loc 1 80
+ .loc 1 80
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 80
+ .loc 2 1
+ .loc 2 1
+ .loc 1 82
+  mov $1, %rax
+  push %rax
+ .loc 1 82
+ .loc 1 82
+ .loc 1 82
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_add
+  push %rax
+ .loc 1 82
+ .loc 1 82
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 82
+ .loc 2 1
+ .loc 2 1
+ .loc 1 83
+  mov $0, %rax
+  push %rax
+ .loc 1 83
+ .loc 1 83
+ .loc 1 83
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_sub
+  push %rax
+ .loc 1 83
+ .loc 1 83
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 83
+ .loc 2 1
+ .loc 2 1
+ .loc 1 84
+  mov $1, %rax
+  push %rax
+ .loc 1 84
+ .loc 1 84
+ .loc 1 84
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_add
+  push %rax
+ .loc 1 84
+ .loc 1 84
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 84
+ .loc 2 1
+ .loc 2 1
+ .loc 1 85
+  mov $0, %rax
+  push %rax
+ .loc 1 85
+ .loc 1 85
+ .loc 1 85
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_sub
+  push %rax
+ .loc 1 85
+ .loc 1 85
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 85
+ .loc 2 1
+ .loc 2 1
+ .loc 1 86
+  mov $1, %rax
+  push %rax
+ .loc 1 86
+ .loc 1 86
+ .loc 1 86
+  mov $0, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_add
+  push %rax
+ .loc 1 86
+ .loc 1 86
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 86
+ .loc 2 1
+ .loc 2 1
+ .loc 1 87
+  mov $1, %rax
+  push %rax
+ .loc 1 87
+ .loc 1 87
+ .loc 1 87
+  mov $0, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call bool_fn_sub
+  push %rax
+ .loc 1 87
+ .loc 1 87
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 87
+ .loc 2 1
+ .loc 2 1
+ .loc 1 89
+  mov $3, %rax
+  push %rax
+ .loc 1 89
+ .loc 1 89
+  mov $0, %rax
+  call static_func
+  push %rax
+ .loc 1 89
+ .loc 1 89
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 89
+ .loc 2 1
+ .loc 2 1
+ .loc 1 91
+  mov $3, %rax
+  push %rax
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+  mov $0, %rax
+  push %rax
+ .loc 1 91
+ .loc 1 91
+  lea -8(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 91
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+ .loc 1 91
+  lea -8(%rbp), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call param_decay
+  push %rax
+ .loc 1 91
+ .loc 1 91
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 91
+ .loc 1 93
+ .loc 1 93
+ .loc 1 93
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 94
+ .loc 1 94
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl param_decay
+  .text
+param_decay:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %rdi, -8(%rbp)
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+  mov $0, %rax
+  push %rax
+ .loc 1 56
+ .loc 1 56
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+ jmp .L.return.param_decay
+.L.return.param_decay:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .local static_func
+  .text
+static_func:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+ .loc 1 54
+ .loc 1 54
+ .loc 1 54
+  mov $3, %rax
+ jmp .L.return.static_func
+.L.return.static_func:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl bool_fn_sub
+  .text
+bool_fn_sub:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %dil, -1(%rbp)
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+  mov $1, %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+  lea -1(%rbp), %rax
+  movsbl (%rax), %eax
+  pop %rdi
+  sub %edi, %eax
+  cmp $0, %eax
+  setne %al
+  movzx %al, %eax
+  movsxd %eax, %rax
+ jmp .L.return.bool_fn_sub
+.L.return.bool_fn_sub:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl bool_fn_add
+  .text
+bool_fn_add:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %dil, -1(%rbp)
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+  mov $1, %rax
+  push %rax
+ .loc 1 51
+ .loc 1 51
+  lea -1(%rbp), %rax
+  movsbl (%rax), %eax
+  pop %rdi
+  add %edi, %eax
+  cmp $0, %eax
+  setne %al
+  movzx %al, %eax
+  movsxd %eax, %rax
+ jmp .L.return.bool_fn_add
+.L.return.bool_fn_add:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl div_long
+  .text
+div_long:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %rdi, -8(%rbp)
+ mov %rsi, -16(%rbp)
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 48
+ .loc 1 48
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  cqo
+  idiv %rdi
+ jmp .L.return.div_long
+.L.return.div_long:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl int_to_char
+  .text
+int_to_char:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %edi, -4(%rbp)
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  movsbl %al, %eax
+ jmp .L.return.int_to_char
+.L.return.int_to_char:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl g1_ptr
+  .text
+g1_ptr:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+  lea g1(%rip), %rax
+ jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_short
+  .text
+sub_short:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %di, -2(%rbp)
+ mov %si, -4(%rbp)
+ mov %dx, -6(%rbp)
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  lea -6(%rbp), %rax
+ movswl (%rax), %eax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  lea -4(%rbp), %rax
+ movswl (%rax), %eax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea -2(%rbp), %rax
+ movswl (%rax), %eax
+  pop %rdi
+  sub %edi, %eax
+  pop %rdi
+  sub %edi, %eax
+ jmp .L.return.sub_short
+.L.return.sub_short:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_long
+  .text
+sub_long:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+ mov %rdi, -8(%rbp)
+ mov %rsi, -16(%rbp)
+ mov %rdx, -24(%rbp)
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  lea -24(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+ jmp .L.return.sub_long
+.L.return.sub_long:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl fib
+  .text
+fib:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %edi, -4(%rbp)
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $1, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  cmp %edi, %eax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je  .L.else.fib.1
+ .loc 1 30
+ .loc 1 30
+  mov $1, %rax
+ jmp .L.return.fib
+  jmp .L.end.fib.1
+.L.else.fib.1:
+.L.end.fib.1:
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $2, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  sub %edi, %eax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  push %rax
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $1, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  sub %edi, %eax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  pop %rdi
+  add %edi, %eax
+ jmp .L.return.fib
+.L.return.fib:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_char
+  .text
+sub_char:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %dil, -1(%rbp)
+ mov %sil, -2(%rbp)
+ mov %dl, -3(%rbp)
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -3(%rbp), %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -2(%rbp), %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -1(%rbp), %rax
+  movsbl (%rax), %eax
+  pop %rdi
+  sub %edi, %eax
+  pop %rdi
+  sub %edi, %eax
+ jmp .L.return.sub_char
+.L.return.sub_char:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl addx
+  .text
+addx:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %rdi, -8(%rbp)
+ mov %esi, -12(%rbp)
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  lea -12(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+ jmp .L.return.addx
+.L.return.addx:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl add6
+  .text
+add6:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+ mov %edi, -4(%rbp)
+ mov %esi, -8(%rbp)
+ mov %edx, -12(%rbp)
+ mov %ecx, -16(%rbp)
+ mov %r8d, -20(%rbp)
+ mov %r9d, -24(%rbp)
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -24(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -20(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -16(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -12(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  lea -8(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+  add %edi, %eax
+  pop %rdi
+  add %edi, %eax
+ jmp .L.return.add6
+.L.return.add6:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub2
+  .text
+sub2:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %edi, -4(%rbp)
+ mov %esi, -8(%rbp)
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  lea -8(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  sub %edi, %eax
+ jmp .L.return.sub2
+.L.return.sub2:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl add2
+  .text
+add2:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+ mov %edi, -4(%rbp)
+ mov %esi, -8(%rbp)
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -8(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea -4(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+ jmp .L.return.add2
+.L.return.add2:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl ret3
+  .text
+ret3:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  mov $3, %rax
+ jmp .L.return.ret3
+ .loc 1 5
+ .loc 1 5
+  mov $5, %rax
+ jmp .L.return.ret3
+.L.return.ret3:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
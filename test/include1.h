@@ -0,0 +1,6 @@
+#ifndef INCLUDE1_H
+#define INCLUDE1_H
+
+int include1() { return 5; }
+
+#endif
@@ -0,0 +1,126 @@
+.file 1 "test/literal.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 39
+  .byte 92
+  .byte 120
+  .byte 56
+  .byte 48
+  .byte 39
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $97, %rax
+  push %rax
+ .loc 1 4
+  mov $97, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $10, %rax
+  push %rax
+ .loc 1 5
+  mov $10, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $-128, %rax
+  push %rax
+ .loc 1 6
+  mov $-128, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 9
+ .loc 1 9
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
@@ -0,0 +1,79 @@
+#include "test.h"
+#include "include1.h"
+#include "include1.h"
+#include "include2.h"
+#include "include2.h"
+
+#define ONE 1
+#define TWO ONE + ONE
+#define ADD(x, y) ((x) + (y))
+#define STR(x) #x
+#define CAT(x, y) x##y
+#define FIRST(x, ...) x
+#define REST(x, ...) __VA_ARGS__
+#define APPLY(f, x) f(x)
+#define TWICE(x) (2 * (x))
+#define CALL(f, ...) f(__VA_ARGS__)
+#define EMPTY
+
+int self_ref() {
+        int SELF = 3;
+#define SELF SELF + 1
+        return SELF;
+}
+
+#if TWO == 2 && defined(ONE) && !defined UNDEFINED
+int if_taken() { return 1; }
+#else
+int if_taken() { return 0; }
+#endif
+
+#ifdef UNDEFINED
+#error must not be reached
+#elif ADD(1, 2) == 3
+int elif_taken() { return 1; }
+#else
+int elif_taken() { return 0; }
+#endif
+
+#ifndef ONE
+int nested() { return 0; }
+#else
+#if 0
+int nested() { return 0; }
+#else
+int nested() { return 1; }
+#endif
+#endif
+
+#define TEMP 1
+#undef TEMP
+#ifdef TEMP
+int undef_works() { return 0; }
+#else
+int undef_works() { return 1; }
+#endif
+
+int main() {
+        ASSERT(5, include1());
+        ASSERT(7, include2());
+        ASSERT(2, TWO);
+        ASSERT(7, ADD(3, 4));
+        ASSERT(9, ADD(ADD(1, 2), ADD(3, 3)));
+        ASSERT(6, sizeof(STR(a + b)));
+        ASSERT(12, sizeof(STR("quoted \n")));
+        ASSERT(12, CAT(1, 2));
+        ASSERT(5, ({ int CAT(x, 1) = 5; x1; }));
+        ASSERT(3, FIRST(3, 4, 5));
+        ASSERT(9, CALL(ADD, REST(1, 4, 5)));
+        ASSERT(4, self_ref());
+        ASSERT(6, APPLY(TWICE, 3));
+        ASSERT(3, EMPTY 3 EMPTY);
+        ASSERT(1, if_taken());
+        ASSERT(1, elif_taken());
+        ASSERT(1, nested());
+        ASSERT(1, undef_works());
+
+        printf("\nEVERYTHING GOOD\n");
+        return 0;
+}
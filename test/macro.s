@@ -0,0 +1,694 @@
+.file 1 "/root/repo/test/macro.c"
+.file 2 "/root/repo/test/test.h"
+.file 3 "/root/repo/test/include1.h"
+.file 4 "/root/repo/test/include2.h"
+.file 5 "<built-in>"
+.file 6 "<built-in>"
+.file 7 "<scratch>"
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 117
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 95
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 107
+  .byte 115
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 101
+  .byte 108
+  .byte 105
+  .byte 102
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 105
+  .byte 102
+  .byte 95
+  .byte 116
+  .byte 97
+  .byte 107
+  .byte 101
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 69
+  .byte 77
+  .byte 80
+  .byte 84
+  .byte 89
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 69
+  .byte 77
+  .byte 80
+  .byte 84
+  .byte 89
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 65
+  .byte 80
+  .byte 80
+  .byte 76
+  .byte 89
+  .byte 40
+  .byte 84
+  .byte 87
+  .byte 73
+  .byte 67
+  .byte 69
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 115
+  .byte 101
+  .byte 108
+  .byte 102
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 102
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 67
+  .byte 65
+  .byte 76
+  .byte 76
+  .byte 40
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 44
+  .byte 32
+  .byte 82
+  .byte 69
+  .byte 83
+  .byte 84
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 70
+  .byte 73
+  .byte 82
+  .byte 83
+  .byte 84
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 83
+  .byte 84
+  .byte 82
+  .byte 40
+  .byte 34
+  .byte 113
+  .byte 117
+  .byte 111
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 41
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 34
+  .byte 113
+  .byte 117
+  .byte 111
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 32
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 83
+  .byte 84
+  .byte 82
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 98
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 84
+  .byte 87
+  .byte 79
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 50
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 49
+  .byte 40
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %rbx, -8(%rbp)
+.L.bb.main.0:
+ .loc 2 1
+ .loc 1 58
+  mov $5, %rbx
+  xor %eax, %eax
+  call include1
+  mov %rax, %rcx
+  lea .L..0(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 59
+  mov $7, %rbx
+  xor %eax, %eax
+  call include2
+  mov %rax, %rcx
+  lea .L..1(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 60
+  mov $2, %rcx
+ .loc 1 8
+  mov $2, %rsi
+ .loc 1 60
+  lea .L..2(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 61
+  mov $7, %rcx
+ .loc 1 9
+  mov $7, %rsi
+ .loc 1 61
+  lea .L..3(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 62
+  mov $9, %rcx
+ .loc 1 9
+  mov $9, %rsi
+ .loc 1 62
+  lea .L..4(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 63
+  mov $6, %rcx
+  mov $6, %rsi
+  lea .L..6(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 64
+  mov $12, %rcx
+  mov $12, %rsi
+  lea .L..8(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 65
+  mov $12, %rcx
+  mov $12, %rsi
+  lea .L..9(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 66
+  mov $5, %rcx
+  mov $5, %rsi
+  lea .L..10(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 67
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..11(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 68
+  mov $9, %rcx
+ .loc 1 9
+  mov $9, %rsi
+ .loc 1 68
+  lea .L..12(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 69
+  mov $4, %rbx
+  xor %eax, %eax
+  call self_ref
+  mov %rax, %rcx
+  lea .L..13(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 70
+  mov $6, %rcx
+ .loc 1 15
+  mov $6, %rsi
+ .loc 1 70
+  lea .L..14(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 71
+  mov $3, %rcx
+  mov $3, %rsi
+  lea .L..15(%rip), %rdi
+  mov %rdi, %rdx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 72
+  mov $1, %rbx
+  xor %eax, %eax
+  call if_taken
+  mov %rax, %rcx
+  lea .L..16(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 73
+  mov $1, %rbx
+  xor %eax, %eax
+  call elif_taken
+  mov %rax, %rcx
+  lea .L..17(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 74
+  mov $1, %rbx
+  xor %eax, %eax
+  call nested
+  mov %rax, %rcx
+  lea .L..18(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 75
+  mov $1, %rbx
+  xor %eax, %eax
+  call undef_works
+  mov %rax, %rcx
+  lea .L..19(%rip), %rsi
+  mov %rbx, %rdi
+  mov %rsi, %rdx
+  mov %rcx, %rsi
+  xor %eax, %eax
+  call assert
+  mov %rax, %rcx
+ .loc 1 77
+  lea .L..20(%rip), %rcx
+  mov %rcx, %rdi
+  xor %eax, %eax
+  call printf
+  mov %rax, %rcx
+ .loc 1 78
+  xor %ecx, %ecx
+  mov %rcx, %rax
+.L.return.main:
+  mov -8(%rbp), %rbx
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl undef_works
+  .text
+undef_works:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.undef_works.0:
+ .loc 1 54
+  mov $1, %rcx
+  mov %rcx, %rax
+.L.return.undef_works:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl nested
+  .text
+nested:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.nested.0:
+ .loc 1 45
+  mov $1, %rcx
+  mov %rcx, %rax
+.L.return.nested:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl elif_taken
+  .text
+elif_taken:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.elif_taken.0:
+ .loc 1 34
+  mov $1, %rcx
+  mov %rcx, %rax
+.L.return.elif_taken:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl if_taken
+  .text
+if_taken:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.if_taken.0:
+ .loc 1 26
+  mov $1, %rcx
+  mov %rcx, %rax
+.L.return.if_taken:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl self_ref
+  .text
+self_ref:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.self_ref.0:
+ .loc 1 20
+ .loc 1 21
+  mov $4, %rcx
+  mov %rcx, %rax
+.L.return.self_ref:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl include2
+  .text
+include2:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.include2.0:
+ .loc 4 3
+  mov $7, %rcx
+  mov %rcx, %rax
+.L.return.include2:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl include1
+  .text
+include1:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+.L.bb.include1.0:
+ .loc 3 4
+  mov $5, %rcx
+  mov %rcx, %rax
+.L.return.include1:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
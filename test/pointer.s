@@ -0,0 +1,3661 @@
+.file 1 "test/pointer.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..32
+  .section .rodata
+.L..32:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..31
+  .section .rodata
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .section .rodata
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $704, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $3, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  lea -696(%rbp), %rax
+  push %rax
+ .loc 1 4
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  lea -696(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $3, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  lea -692(%rbp), %rax
+  push %rax
+ .loc 1 5
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  lea -688(%rbp), %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea -692(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  lea -680(%rbp), %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea -688(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  lea -680(%rbp), %rax
+  mov (%rax), %rax
+  mov (%rax), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $5, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+  lea -668(%rbp), %rax
+  push %rax
+ .loc 1 6
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+  lea -664(%rbp), %rax
+  push %rax
+ .loc 1 6
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+  mov $4, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea -668(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $3, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  lea -660(%rbp), %rax
+  push %rax
+ .loc 1 7
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  lea -656(%rbp), %rax
+  push %rax
+ .loc 1 7
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  mov $4, %rax
+  push %rax
+ .loc 1 7
+  lea -656(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $5, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -652(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -648(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  mov $-4, %rax
+  push %rax
+ .loc 1 8
+  lea -652(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 9
+  mov $5, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -644(%rbp), %rax
+  push %rax
+ .loc 1 9
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -640(%rbp), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea -644(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -640(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 9
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 9
+ .loc 1 9
+  lea -644(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 9
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $7, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -628(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -624(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  mov $4, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -628(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 10
+  mov $7, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+  lea -624(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 11
+  mov $7, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -620(%rbp), %rax
+  push %rax
+ .loc 1 11
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -616(%rbp), %rax
+  push %rax
+ .loc 1 11
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  mov $4, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  mov $8, %rax
+  push %rax
+ .loc 1 11
+  lea -616(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 11
+  mov $7, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+  lea -620(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 11
+ .loc 2 1
+ .loc 2 1
+ .loc 1 12
+  mov $5, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  lea -612(%rbp), %rax
+  push %rax
+ .loc 1 12
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $3, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $4, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  lea -612(%rbp), %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $8, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -612(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+ cdq
+  idiv %edi
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 12
+ .loc 2 1
+ .loc 2 1
+ .loc 1 13
+  mov $8, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  lea -608(%rbp), %rax
+  push %rax
+ .loc 1 13
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 13
+ .loc 1 13
+  lea -604(%rbp), %rax
+  push %rax
+ .loc 1 13
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  lea -604(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea -608(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 13
+ .loc 2 1
+ .loc 2 1
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  lea -600(%rbp), %rax
+  push %rax
+ .loc 1 14
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 14
+ .loc 1 14
+  lea -596(%rbp), %rax
+  push %rax
+ .loc 1 14
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  lea -596(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea -600(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 14
+ .loc 2 1
+ .loc 2 1
+ .loc 1 16
+  mov $3, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  lea -584(%rbp), %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea -592(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  lea -584(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 16
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  lea -592(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 16
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $3, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -572(%rbp), %rax
+  push %rax
+ .loc 1 18
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  mov $4, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea -572(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 18
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  mov $8, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea -572(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 18
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -572(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 19
+  mov $4, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  lea -560(%rbp), %rax
+  push %rax
+ .loc 1 19
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  mov $4, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea -560(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 19
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  mov $8, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea -560(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 19
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  mov $4, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea -560(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 19
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $5, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  lea -548(%rbp), %rax
+  push %rax
+ .loc 1 20
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $4, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea -548(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 20
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $8, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea -548(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 20
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $8, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea -548(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $0, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -512(%rbp), %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea -536(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -512(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 22
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -536(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 23
+  mov $1, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  lea -480(%rbp), %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea -504(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  mov $4, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea -480(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 23
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  mov $4, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  lea -504(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 23
+ .loc 2 1
+ .loc 2 1
+ .loc 1 24
+  mov $2, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  lea -448(%rbp), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea -472(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  mov $8, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea -448(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 24
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  mov $8, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  lea -472(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 24
+ .loc 2 1
+ .loc 2 1
+ .loc 1 25
+  mov $3, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  lea -416(%rbp), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -440(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  mov $12, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -416(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 25
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  mov $12, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea -440(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 25
+ .loc 2 1
+ .loc 2 1
+ .loc 1 26
+  mov $4, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  lea -384(%rbp), %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea -408(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  mov $16, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea -384(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 26
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  mov $4, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  mov $12, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea -408(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 26
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $5, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  lea -352(%rbp), %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea -376(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $20, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea -352(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 27
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $8, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $12, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea -376(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $0, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  lea -248(%rbp), %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea -344(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  lea -248(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 28
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  lea -344(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 30
+  mov $3, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  lea -240(%rbp), %rax
+  push %rax
+ .loc 1 30
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $4, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea -240(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $8, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea -240(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  lea -240(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 30
+ .loc 2 1
+ .loc 2 1
+ .loc 1 31
+  mov $4, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  lea -228(%rbp), %rax
+  push %rax
+ .loc 1 31
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $4, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 31
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $8, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 31
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $4, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 31
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $5, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  lea -216(%rbp), %rax
+  push %rax
+ .loc 1 32
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $4, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 32
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $8, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 32
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $8, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 33
+  mov $5, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  lea -204(%rbp), %rax
+  push %rax
+ .loc 1 33
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  mov $4, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 33
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  mov $8, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 33
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  mov $8, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 33
+ .loc 2 1
+ .loc 2 1
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  lea -168(%rbp), %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea -192(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea -168(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 35
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea -192(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 35
+ .loc 2 1
+ .loc 2 1
+ .loc 1 36
+  mov $1, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea -136(%rbp), %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea -160(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  mov $4, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea -136(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 36
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  mov $4, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  mov $0, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea -160(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 36
+ .loc 2 1
+ .loc 2 1
+ .loc 1 37
+  mov $2, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea -104(%rbp), %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea -128(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  mov $8, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea -104(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 37
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  mov $8, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  mov $0, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea -128(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 37
+ .loc 2 1
+ .loc 2 1
+ .loc 1 38
+  mov $3, %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+  lea -72(%rbp), %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+  lea -96(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+  mov $12, %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+  lea -72(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 38
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+  mov $0, %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+ .loc 1 38
+  mov $12, %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+  lea -96(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 38
+ .loc 1 38
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 38
+ .loc 2 1
+ .loc 2 1
+ .loc 1 39
+  mov $4, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  lea -40(%rbp), %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea -64(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  mov $16, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea -40(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 39
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  mov $4, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  mov $12, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea -64(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 39
+ .loc 2 1
+ .loc 2 1
+ .loc 1 40
+  mov $5, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  lea -8(%rbp), %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea -32(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  mov $20, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 40
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  mov $8, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  mov $12, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea -32(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 40
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 42
+ .loc 1 42
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
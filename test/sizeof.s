@@ -0,0 +1,1217 @@
+.file 1 "test/sizeof.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $1, %rax
+  push %rax
+ .loc 1 4
+  mov $1, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $2, %rax
+  push %rax
+ .loc 1 5
+  mov $2, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $2, %rax
+  push %rax
+ .loc 1 6
+  mov $2, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $2, %rax
+  push %rax
+ .loc 1 7
+  mov $2, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $4, %rax
+  push %rax
+ .loc 1 8
+  mov $4, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 9
+  mov $8, %rax
+  push %rax
+ .loc 1 9
+  mov $8, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 9
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $8, %rax
+  push %rax
+ .loc 1 10
+  mov $8, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 11
+  mov $8, %rax
+  push %rax
+ .loc 1 11
+  mov $8, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 11
+ .loc 2 1
+ .loc 2 1
+ .loc 1 12
+  mov $8, %rax
+  push %rax
+ .loc 1 12
+  mov $8, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 12
+ .loc 2 1
+ .loc 2 1
+ .loc 1 13
+  mov $8, %rax
+  push %rax
+ .loc 1 13
+  mov $8, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 13
+ .loc 2 1
+ .loc 2 1
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 14
+ .loc 2 1
+ .loc 2 1
+ .loc 1 15
+  mov $8, %rax
+  push %rax
+ .loc 1 15
+  mov $8, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 15
+ .loc 2 1
+ .loc 2 1
+ .loc 1 16
+  mov $8, %rax
+  push %rax
+ .loc 1 16
+  mov $8, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 16
+ .loc 2 1
+ .loc 2 1
+ .loc 1 17
+  mov $32, %rax
+  push %rax
+ .loc 1 17
+  mov $32, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 17
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $16, %rax
+  push %rax
+ .loc 1 18
+  mov $16, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 19
+  mov $48, %rax
+  push %rax
+ .loc 1 19
+  mov $48, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 19
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $8, %rax
+  push %rax
+ .loc 1 20
+  mov $8, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $8, %rax
+  push %rax
+ .loc 1 22
+  mov $8, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 23
+  mov $8, %rax
+  push %rax
+ .loc 1 23
+  mov $8, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 23
+ .loc 2 1
+ .loc 2 1
+ .loc 1 24
+  mov $8, %rax
+  push %rax
+ .loc 1 24
+  mov $8, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 24
+ .loc 2 1
+ .loc 2 1
+ .loc 1 25
+  mov $8, %rax
+  push %rax
+ .loc 1 25
+  mov $8, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 25
+ .loc 2 1
+ .loc 2 1
+ .loc 1 26
+  mov $8, %rax
+  push %rax
+ .loc 1 26
+  mov $8, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 26
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $8, %rax
+  push %rax
+ .loc 1 27
+  mov $8, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $8, %rax
+  push %rax
+ .loc 1 28
+  mov $8, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 29
+ .loc 2 1
+ .loc 2 1
+ .loc 1 31
+  mov $1, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $1, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 31
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $1, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $1, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 34
+  mov $8, %rax
+  push %rax
+ .loc 1 34
+  mov $8, %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 34
+ .loc 2 1
+ .loc 2 1
+ .loc 1 35
+  mov $8, %rax
+  push %rax
+ .loc 1 35
+  mov $8, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 35
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 38
+ .loc 1 38
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
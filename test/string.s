@@ -0,0 +1,1343 @@
+.file 1 "test/string.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..56
+  .section .rodata
+.L..56:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..55
+  .section .rodata
+.L..55:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 55
+  .byte 55
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..54
+  .section .rodata
+.L..54:
+  .byte 119
+  .byte 0
+  .local .L..53
+  .section .rodata
+.L..53:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..52
+  .section .rodata
+.L..52:
+  .byte 0
+  .byte 0
+  .local .L..51
+  .section .rodata
+.L..51:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 53
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..50
+  .section .rodata
+.L..50:
+  .byte 104
+  .byte 48
+  .byte 0
+  .local .L..49
+  .section .rodata
+.L..49:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..48
+  .section .rodata
+.L..48:
+  .byte 65
+  .byte 0
+  .local .L..47
+  .section .rodata
+.L..47:
+  .byte 34
+  .byte 92
+  .byte 50
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..46
+  .section .rodata
+.L..46:
+  .byte 16
+  .byte 0
+  .local .L..45
+  .section .rodata
+.L..45:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..44
+  .section .rodata
+.L..44:
+  .byte 0
+  .byte 0
+  .local .L..43
+  .section .rodata
+.L..43:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .local .L..42
+  .section .rodata
+.L..42:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..41
+  .section .rodata
+.L..41:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..40
+  .section .rodata
+.L..40:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..39
+  .section .rodata
+.L..39:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..38
+  .section .rodata
+.L..38:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..37
+  .section .rodata
+.L..37:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..36
+  .section .rodata
+.L..36:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..35
+  .section .rodata
+.L..35:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..34
+  .section .rodata
+.L..34:
+  .byte 108
+  .byte 0
+  .local .L..33
+  .section .rodata
+.L..33:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..32
+  .section .rodata
+.L..32:
+  .byte 107
+  .byte 0
+  .local .L..31
+  .section .rodata
+.L..31:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..30
+  .section .rodata
+.L..30:
+  .byte 106
+  .byte 0
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 27
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 13
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 12
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 11
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 10
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 9
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 8
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 7
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 34
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $0, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  mov $0, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $1, %rax
+  push %rax
+ .loc 1 5
+  mov $1, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $97, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  mov $0, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..4(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $98, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  mov $1, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..6(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 9
+  mov $99, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  mov $2, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..8(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 9
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $0, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  mov $3, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..10(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 11
+  mov $4, %rax
+  push %rax
+ .loc 1 11
+  mov $4, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 11
+ .loc 2 1
+ .loc 2 1
+ .loc 1 13
+  mov $7, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  mov $0, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..14(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 13
+ .loc 2 1
+ .loc 2 1
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  mov $0, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..16(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 14
+ .loc 2 1
+ .loc 2 1
+ .loc 1 15
+  mov $9, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  mov $0, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..18(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 15
+ .loc 2 1
+ .loc 2 1
+ .loc 1 16
+  mov $10, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  mov $0, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..20(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 16
+ .loc 2 1
+ .loc 2 1
+ .loc 1 17
+  mov $11, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  mov $0, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea .L..22(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 17
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $12, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  mov $0, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..24(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 19
+  mov $13, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  mov $0, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea .L..26(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 19
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $27, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $0, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..28(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $106, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  mov $0, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..30(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 23
+  mov $107, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  mov $0, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..32(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 23
+ .loc 2 1
+ .loc 2 1
+ .loc 1 24
+  mov $108, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  mov $0, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..34(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 24
+ .loc 2 1
+ .loc 2 1
+ .loc 1 26
+  mov $7, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  mov $0, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..36(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 26
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $120, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $1, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..38(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $10, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $2, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..40(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..41(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 29
+  mov $121, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $3, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..42(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..43(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 29
+ .loc 2 1
+ .loc 2 1
+ .loc 1 31
+  mov $0, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $0, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea .L..44(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea .L..45(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 31
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $16, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $0, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..46(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..47(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 33
+  mov $65, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  mov $0, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..48(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..49(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 33
+ .loc 2 1
+ .loc 2 1
+ .loc 1 34
+  mov $104, %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+  mov $0, %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea .L..50(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea .L..51(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 34
+ .loc 2 1
+ .loc 2 1
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  mov $0, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea .L..52(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea .L..53(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 35
+ .loc 2 1
+ .loc 2 1
+ .loc 1 36
+  mov $119, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  mov $0, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea .L..54(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea .L..55(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 36
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea .L..56(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 38
+ .loc 1 38
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
@@ -0,0 +1,3932 @@
+.file 1 "test/struct.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..40
+  .section .rodata
+.L..40:
+  .byte 10
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..39
+  .section .rodata
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .section .rodata
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 61
+  .byte 38
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 46
+  .byte 110
+  .byte 101
+  .byte 120
+  .byte 116
+  .byte 45
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .section .rodata
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 42
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 84
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .section .rodata
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .section .rodata
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .section .rodata
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .section .rodata
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .section .rodata
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .section .rodata
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .section .rodata
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $496, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 4
+  mov $1, %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+ .loc 1 4
+  lea -484(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 4
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 4
+ .loc 1 4
+  lea -484(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 4
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 4
+ .loc 1 4
+  lea -484(%rbp), %rax
+ add $0, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 4
+ .loc 1 4
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 4
+ .loc 2 1
+ .loc 2 1
+ .loc 1 5
+  mov $2, %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+ .loc 1 5
+  lea -476(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 5
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+  lea -476(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 5
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 5
+ .loc 1 5
+  lea -476(%rbp), %rax
+ add $4, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 5
+ .loc 1 5
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 5
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $1, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+  lea -468(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 6
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 6
+ .loc 1 6
+  lea -468(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 6
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 6
+ .loc 1 6
+  lea -468(%rbp), %rax
+ add $8, %rax
+  push %rax
+ .loc 1 6
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 6
+ .loc 1 6
+  lea -468(%rbp), %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $2, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  lea -456(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 7
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 7
+ .loc 1 7
+  lea -456(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 7
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 7
+ .loc 1 7
+  lea -456(%rbp), %rax
+ add $8, %rax
+  push %rax
+ .loc 1 7
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 7
+ .loc 1 7
+  lea -456(%rbp), %rax
+ add $4, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $3, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -444(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 8
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 8
+ .loc 1 8
+  lea -444(%rbp), %rax
+ add $4, %rax
+  push %rax
+ .loc 1 8
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 8
+ .loc 1 8
+  lea -444(%rbp), %rax
+ add $8, %rax
+  push %rax
+ .loc 1 8
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 8
+ .loc 1 8
+  lea -444(%rbp), %rax
+ add $8, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $0, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -424(%rbp), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -430(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  mov $0, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -424(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 10
+  mov $0, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  mov $0, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea -430(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 11
+  mov $1, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -408(%rbp), %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea -414(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  mov $1, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea -408(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 11
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  mov $0, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea -414(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ add $1, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 11
+ .loc 2 1
+ .loc 2 1
+ .loc 1 12
+  mov $2, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  lea -392(%rbp), %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -398(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $2, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -392(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 12
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+ .loc 1 12
+  mov $2, %rax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea -398(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 12
+ .loc 1 12
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 12
+ .loc 2 1
+ .loc 2 1
+ .loc 1 13
+  mov $3, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  lea -376(%rbp), %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea -382(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  mov $3, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea -376(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 13
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  mov $2, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea -382(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+ add $1, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 13
+ .loc 2 1
+ .loc 2 1
+ .loc 1 15
+  mov $6, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  lea -360(%rbp), %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea -368(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  mov $0, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea -368(%rbp), %rax
+ add $0, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 15
+  mov $6, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  mov $0, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea -360(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 15
+ .loc 2 1
+ .loc 2 1
+ .loc 1 16
+  mov $7, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  lea -344(%rbp), %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea -352(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  mov $0, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea -352(%rbp), %rax
+ add $3, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 16
+  mov $7, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  mov $3, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea -344(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 16
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $6, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  lea -333(%rbp), %rax
+ add $0, %rax
+ add $0, %rax
+  push %rax
+ .loc 1 18
+  mov $6, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 18
+ .loc 1 18
+  lea -333(%rbp), %rax
+ add $0, %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $4, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $4, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 21
+  mov $8, %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  mov $8, %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 21
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $8, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  mov $8, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 23
+  mov $12, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  mov $12, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 23
+ .loc 2 1
+ .loc 2 1
+ .loc 1 24
+  mov $16, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+ .loc 1 24
+  mov $16, %rax
+  push %rax
+ .loc 1 24
+ .loc 1 24
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 24
+ .loc 2 1
+ .loc 2 1
+ .loc 1 25
+  mov $24, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+ .loc 1 25
+  mov $24, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 25
+ .loc 2 1
+ .loc 2 1
+ .loc 1 26
+  mov $2, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  mov $2, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 26
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $0, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $0, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $8, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $8, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 29
+ .loc 2 1
+ .loc 2 1
+ .loc 1 31
+  mov $8, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+ .loc 1 31
+  mov $8, %rax
+  push %rax
+ .loc 1 31
+ .loc 1 31
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 31
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $8, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+ .loc 1 32
+  mov $8, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 33
+  mov $2, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+ .loc 1 33
+  mov $2, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 33
+ .loc 2 1
+ .loc 2 1
+ .loc 1 34
+  mov $3, %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+  lea -212(%rbp), %rax
+  push %rax
+ .loc 1 34
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+  lea -208(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 34
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+ .loc 1 34
+  lea -208(%rbp), %rax
+ add $0, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea -212(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 34
+ .loc 1 34
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 34
+ .loc 2 1
+ .loc 2 1
+ .loc 1 36
+  mov $3, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea -200(%rbp), %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea -201(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 36
+ .loc 1 36
+  lea -201(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 36
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea -200(%rbp), %rax
+  mov (%rax), %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 36
+ .loc 2 1
+ .loc 2 1
+ .loc 1 37
+  mov $3, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea -184(%rbp), %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea -185(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea -184(%rbp), %rax
+  mov (%rax), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 37
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 37
+ .loc 1 37
+  lea -185(%rbp), %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 37
+ .loc 2 1
+ .loc 2 1
+ .loc 1 39
+  mov $3, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  lea -176(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 39
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 39
+ .loc 1 39
+  lea -168(%rbp), %rax
+  push %rax
+ .loc 1 39
+  lea -176(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+ .loc 1 39
+ .loc 1 39
+  lea -168(%rbp), %rax
+ add $0, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 39
+ .loc 2 1
+ .loc 2 1
+ .loc 1 40
+  mov $7, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  lea -160(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 40
+  mov $7, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  lea -144(%rbp), %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea -152(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  lea -144(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 40
+  lea -160(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+ .loc 1 40
+ .loc 1 40
+  lea -152(%rbp), %rax
+ add $0, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 40
+ .loc 2 1
+ .loc 2 1
+ .loc 1 41
+  mov $7, %rax
+  push %rax
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+  lea -136(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 41
+  mov $7, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+  lea -120(%rbp), %rax
+  push %rax
+ .loc 1 41
+ .loc 1 41
+  lea -136(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 41
+ .loc 1 41
+  lea -112(%rbp), %rax
+  push %rax
+ .loc 1 41
+ .loc 1 41
+  lea -128(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 41
+ .loc 1 41
+ .loc 1 41
+  lea -112(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 41
+ .loc 1 41
+  lea -120(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+ .loc 1 41
+ .loc 1 41
+  lea -128(%rbp), %rax
+ add $0, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 41
+ .loc 1 41
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 41
+ .loc 2 1
+ .loc 2 1
+ .loc 1 42
+  mov $5, %rax
+  push %rax
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+  lea -100(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 42
+  mov $5, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 42
+ .loc 1 42
+  lea -98(%rbp), %rax
+  push %rax
+ .loc 1 42
+  lea -100(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+ .loc 1 42
+ .loc 1 42
+  lea -98(%rbp), %rax
+ add $0, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 42
+ .loc 1 42
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 42
+ .loc 2 1
+ .loc 2 1
+ .loc 1 44
+  mov $8, %rax
+  push %rax
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+  mov $8, %rax
+  push %rax
+ .loc 1 44
+ .loc 1 44
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 44
+ .loc 2 1
+ .loc 2 1
+ .loc 1 45
+  mov $8, %rax
+  push %rax
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+ .loc 1 45
+  mov $8, %rax
+  push %rax
+ .loc 1 45
+ .loc 1 45
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 45
+ .loc 2 1
+ .loc 2 1
+ .loc 1 47
+  mov $16, %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+  mov $16, %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+  lea .L..34(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 47
+ .loc 2 1
+ .loc 2 1
+ .loc 1 48
+  mov $4, %rax
+  push %rax
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+ .loc 1 48
+  mov $4, %rax
+  push %rax
+ .loc 1 48
+ .loc 1 48
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 48
+ .loc 2 1
+ .loc 2 1
+ .loc 1 50
+  mov $8, %rax
+  push %rax
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+  mov $8, %rax
+  push %rax
+ .loc 1 50
+ .loc 1 50
+  lea .L..36(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 50
+ .loc 2 1
+ .loc 2 1
+ .loc 1 51
+  mov $4, %rax
+  push %rax
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+ .loc 1 51
+  mov $4, %rax
+  push %rax
+ .loc 1 51
+ .loc 1 51
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 51
+ .loc 2 1
+ .loc 2 1
+ .loc 1 52
+  mov $1, %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+  lea -16(%rbp), %rax
+ add $8, %rax
+  push %rax
+ .loc 1 52
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 52
+ .loc 1 52
+  lea -32(%rbp), %rax
+ add $0, %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+  lea -16(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+  lea -32(%rbp), %rax
+ add $0, %rax
+  mov (%rax), %rax
+ add $8, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+  lea .L..38(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 52
+ .loc 2 1
+ .loc 2 1
+ .loc 1 53
+  mov $4, %rax
+  push %rax
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+  mov $4, %rax
+  push %rax
+ .loc 1 53
+ .loc 1 53
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 53
+ .loc 1 55
+ .loc 1 55
+ .loc 1 55
+  lea .L..40(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 56
+ .loc 1 56
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
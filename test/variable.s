@@ -0,0 +1,3460 @@
+.file 1 "test/variable.c"
+.file 2 "test/test.h"
+.file 3 "<scratch>"
+  .local .L..45
+  .section .rodata
+.L..45:
+  .byte 69
+  .byte 86
+  .byte 69
+  .byte 82
+  .byte 89
+  .byte 84
+  .byte 72
+  .byte 73
+  .byte 78
+  .byte 71
+  .byte 32
+  .byte 71
+  .byte 79
+  .byte 79
+  .byte 68
+  .byte 10
+  .byte 0
+  .local .L..44
+  .section .rodata
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .section .rodata
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .section .rodata
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .section .rodata
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..40
+  .section .rodata
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .section .rodata
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .section .rodata
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .section .rodata
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .section .rodata
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .section .rodata
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .section .rodata
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .section .rodata
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .section .rodata
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .section .rodata
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .section .rodata
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .section .rodata
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .section .rodata
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .section .rodata
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .section .rodata
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..25
+  .section .rodata
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 41
+  .byte 0
+  .local .L..23
+  .section .rodata
+.L..23:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..21
+  .section .rodata
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..19
+  .section .rodata
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..17
+  .section .rodata
+.L..17:
+  .byte 103
+  .byte 49
+  .byte 0
+  .local .L..16
+  .section .rodata
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .section .rodata
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .section .rodata
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .section .rodata
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .section .rodata
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .section .rodata
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .section .rodata
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .section .rodata
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .section .rodata
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .section .rodata
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .section .rodata
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .section .rodata
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 98
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 98
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 105
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .section .rodata
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 98
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 107
+  .byte 105
+  .byte 98
+  .byte 105
+  .byte 100
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .section .rodata
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .section .rodata
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .section .rodata
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .section .rodata
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl arr
+  .bss
+arr:
+  .zero 16
+  .globl g1
+  .bss
+g1:
+  .zero 4
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $592, %rsp
+ .loc 2 1
+ .loc 2 1
+ .loc 2 1
+ .loc 1 6
+  mov $5, %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+ .loc 1 6
+  lea -592(%rbp), %rax
+  push %rax
+ .loc 1 6
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 6
+ .loc 1 6
+  lea -592(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 6
+ .loc 1 6
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 6
+ .loc 2 1
+ .loc 2 1
+ .loc 1 7
+  mov $5, %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+ .loc 1 7
+  lea -588(%rbp), %rax
+  push %rax
+ .loc 1 7
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 7
+ .loc 1 7
+  lea -588(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 7
+ .loc 1 7
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 7
+ .loc 2 1
+ .loc 2 1
+ .loc 1 8
+  mov $9, %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -584(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -580(%rbp), %rax
+  push %rax
+ .loc 1 8
+  mov $7, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+ .loc 1 8
+  lea -580(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea -584(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 8
+ .loc 1 8
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 8
+ .loc 2 1
+ .loc 2 1
+ .loc 1 9
+  mov $6, %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -576(%rbp), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea -572(%rbp), %rax
+  push %rax
+ .loc 1 9
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+ .loc 1 9
+  lea -572(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea -576(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 9
+ .loc 1 9
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 9
+ .loc 2 1
+ .loc 2 1
+ .loc 1 10
+  mov $2, %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+ .loc 1 10
+  lea -568(%rbp), %rax
+  push %rax
+ .loc 1 10
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 10
+ .loc 1 10
+  lea -568(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 10
+ .loc 1 10
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 10
+ .loc 2 1
+ .loc 2 1
+ .loc 1 11
+  mov $8, %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -564(%rbp), %rax
+  push %rax
+ .loc 1 11
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -560(%rbp), %rax
+  push %rax
+ .loc 1 11
+  mov $5, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+ .loc 1 11
+  lea -560(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea -564(%rbp), %rax
+ movsxd (%rax), %rax
+  pop %rdi
+  add %edi, %eax
+  push %rax
+ .loc 1 11
+ .loc 1 11
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 11
+ .loc 2 1
+ .loc 2 1
+ .loc 1 13
+  mov $4, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+ .loc 1 13
+  mov $4, %rax
+  push %rax
+ .loc 1 13
+ .loc 1 13
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 13
+ .loc 2 1
+ .loc 2 1
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+ .loc 1 14
+  mov $8, %rax
+  push %rax
+ .loc 1 14
+ .loc 1 14
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 14
+ .loc 2 1
+ .loc 2 1
+ .loc 1 15
+  mov $16, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+ .loc 1 15
+  mov $16, %rax
+  push %rax
+ .loc 1 15
+ .loc 1 15
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 15
+ .loc 2 1
+ .loc 2 1
+ .loc 1 16
+  mov $48, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+ .loc 1 16
+  mov $48, %rax
+  push %rax
+ .loc 1 16
+ .loc 1 16
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 16
+ .loc 2 1
+ .loc 2 1
+ .loc 1 17
+  mov $16, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+ .loc 1 17
+  mov $16, %rax
+  push %rax
+ .loc 1 17
+ .loc 1 17
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 17
+ .loc 2 1
+ .loc 2 1
+ .loc 1 18
+  mov $4, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+ .loc 1 18
+  mov $4, %rax
+  push %rax
+ .loc 1 18
+ .loc 1 18
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 18
+ .loc 2 1
+ .loc 2 1
+ .loc 1 19
+  mov $5, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+ .loc 1 19
+  mov $5, %rax
+  push %rax
+ .loc 1 19
+ .loc 1 19
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 19
+ .loc 2 1
+ .loc 2 1
+ .loc 1 20
+  mov $5, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+ .loc 1 20
+  mov $5, %rax
+  push %rax
+ .loc 1 20
+ .loc 1 20
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 20
+ .loc 2 1
+ .loc 2 1
+ .loc 1 21
+  mov $4, %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+ .loc 1 21
+  mov $4, %rax
+  push %rax
+ .loc 1 21
+ .loc 1 21
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 21
+ .loc 2 1
+ .loc 2 1
+ .loc 1 22
+  mov $4, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+ .loc 1 22
+  lea -236(%rbp), %rax
+  push %rax
+ .loc 1 22
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 22
+ .loc 1 22
+  mov $4, %rax
+  push %rax
+ .loc 1 22
+ .loc 1 22
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 22
+ .loc 2 1
+ .loc 2 1
+ .loc 1 23
+  mov $1, %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+ .loc 1 23
+  lea -232(%rbp), %rax
+  push %rax
+ .loc 1 23
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 23
+ .loc 1 23
+  mov $4, %rax
+ .loc 1 23
+ .loc 1 23
+  lea -232(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 23
+ .loc 1 23
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 23
+ .loc 2 1
+ .loc 2 1
+ .loc 1 25
+  mov $0, %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea g1(%rip), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 25
+ .loc 1 25
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 25
+ .loc 2 1
+ .loc 2 1
+ .loc 1 26
+  mov $3, %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+ .loc 1 26
+  lea g1(%rip), %rax
+  push %rax
+ .loc 1 26
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 26
+ .loc 1 26
+  lea g1(%rip), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 26
+ .loc 1 26
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 26
+ .loc 2 1
+ .loc 2 1
+ .loc 1 27
+  mov $0, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $0, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 27
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $4, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 27
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $8, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 27
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $12, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 27
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+ .loc 1 27
+  mov $0, %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 27
+ .loc 1 27
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 27
+ .loc 2 1
+ .loc 2 1
+ .loc 1 28
+  mov $1, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $0, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 28
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $4, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 28
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $8, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 28
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $12, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 28
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+ .loc 1 28
+  mov $4, %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 28
+ .loc 1 28
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 28
+ .loc 2 1
+ .loc 2 1
+ .loc 1 29
+  mov $2, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $0, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 29
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $4, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 29
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 29
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $12, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 29
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+ .loc 1 29
+  mov $8, %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 29
+ .loc 1 29
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 29
+ .loc 2 1
+ .loc 2 1
+ .loc 1 30
+  mov $3, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $0, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $0, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $4, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $1, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $8, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $12, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 30
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+ .loc 1 30
+  mov $12, %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea arr(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 30
+ .loc 1 30
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 30
+ .loc 2 1
+ .loc 2 1
+ .loc 1 32
+  mov $4, %rax
+  push %rax
+ .loc 1 32
+  mov $4, %rax
+  push %rax
+ .loc 1 32
+ .loc 1 32
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 32
+ .loc 2 1
+ .loc 2 1
+ .loc 1 33
+  mov $16, %rax
+  push %rax
+ .loc 1 33
+  mov $16, %rax
+  push %rax
+ .loc 1 33
+ .loc 1 33
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 33
+ .loc 2 1
+ .loc 2 1
+ .loc 1 35
+  mov $1, %rax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+ .loc 1 35
+  lea -228(%rbp), %rax
+  push %rax
+ .loc 1 35
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 35
+ .loc 1 35
+  lea -228(%rbp), %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 35
+ .loc 1 35
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 35
+ .loc 2 1
+ .loc 2 1
+ .loc 1 36
+  mov $1, %rax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea -227(%rbp), %rax
+  push %rax
+ .loc 1 36
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 36
+ .loc 1 36
+ .loc 1 36
+  lea -226(%rbp), %rax
+  push %rax
+ .loc 1 36
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 36
+ .loc 1 36
+  lea -227(%rbp), %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 36
+ .loc 1 36
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 36
+ .loc 2 1
+ .loc 2 1
+ .loc 1 37
+  mov $2, %rax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea -225(%rbp), %rax
+  push %rax
+ .loc 1 37
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 37
+ .loc 1 37
+ .loc 1 37
+  lea -224(%rbp), %rax
+  push %rax
+ .loc 1 37
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 37
+ .loc 1 37
+  lea -224(%rbp), %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 37
+ .loc 1 37
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 37
+ .loc 2 1
+ .loc 2 1
+ .loc 1 39
+  mov $1, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+ .loc 1 39
+  mov $1, %rax
+  push %rax
+ .loc 1 39
+ .loc 1 39
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 39
+ .loc 2 1
+ .loc 2 1
+ .loc 1 40
+  mov $10, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+ .loc 1 40
+  mov $10, %rax
+  push %rax
+ .loc 1 40
+ .loc 1 40
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 40
+ .loc 2 1
+ .loc 2 1
+ .loc 1 42
+  mov $2, %rax
+  push %rax
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+  lea -212(%rbp), %rax
+  push %rax
+ .loc 1 42
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+ .loc 1 42
+  lea -208(%rbp), %rax
+  push %rax
+ .loc 1 42
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 42
+ .loc 1 42
+  lea -212(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 42
+ .loc 1 42
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 42
+ .loc 2 1
+ .loc 2 1
+ .loc 1 43
+  mov $2, %rax
+  push %rax
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+  lea -204(%rbp), %rax
+  push %rax
+ .loc 1 43
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+  lea -200(%rbp), %rax
+  push %rax
+ .loc 1 43
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 43
+ .loc 1 43
+ .loc 1 43
+  lea -196(%rbp), %rax
+  push %rax
+ .loc 1 43
+  mov $4, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 43
+ .loc 1 43
+  lea -204(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 43
+ .loc 1 43
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 43
+ .loc 2 1
+ .loc 2 1
+ .loc 1 44
+  mov $3, %rax
+  push %rax
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+  lea -192(%rbp), %rax
+  push %rax
+ .loc 1 44
+  mov $2, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 44
+ .loc 1 44
+ .loc 1 44
+  lea -192(%rbp), %rax
+  push %rax
+ .loc 1 44
+  mov $3, %rax
+  pop %rdi
+ mov %eax, (%rdi)
+ .loc 1 44
+ .loc 1 44
+  lea -192(%rbp), %rax
+ movsxd (%rax), %rax
+  push %rax
+ .loc 1 44
+ .loc 1 44
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 44
+ .loc 2 1
+ .loc 2 1
+ .loc 1 46
+  mov $7, %rax
+  push %rax
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+  lea -176(%rbp), %rax
+  push %rax
+ .loc 1 46
+ .loc 1 46
+  lea -184(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+  lea -168(%rbp), %rax
+  push %rax
+ .loc 1 46
+ .loc 1 46
+  lea -177(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+  mov $1, %rax
+  push %rax
+ .loc 1 46
+ .loc 1 46
+ .loc 1 46
+  lea -176(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 46
+  lea -168(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+ cdq
+  idiv %edi
+  push %rax
+ .loc 1 46
+ .loc 1 46
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 46
+ .loc 2 1
+ .loc 2 1
+ .loc 1 47
+  mov $1, %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+  lea -144(%rbp), %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+  lea -149(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+  lea -136(%rbp), %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+  lea -148(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+  mov $1, %rax
+  push %rax
+ .loc 1 47
+ .loc 1 47
+ .loc 1 47
+  lea -144(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+ .loc 1 47
+  lea -136(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+ cdq
+  idiv %edi
+  push %rax
+ .loc 1 47
+ .loc 1 47
+  lea .L..34(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 47
+ .loc 2 1
+ .loc 2 1
+ .loc 1 49
+  mov $8, %rax
+  push %rax
+ .loc 1 49
+ .loc 1 49
+ .loc 1 49
+ .loc 1 49
+ .loc 1 49
+  mov $8, %rax
+  push %rax
+ .loc 1 49
+ .loc 1 49
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 49
+ .loc 2 1
+ .loc 2 1
+ .loc 1 50
+  mov $2, %rax
+  push %rax
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+ .loc 1 50
+  mov $2, %rax
+  push %rax
+ .loc 1 50
+ .loc 1 50
+  lea .L..36(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 50
+ .loc 2 1
+ .loc 2 1
+ .loc 1 52
+  mov $24, %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+ .loc 1 52
+  mov $24, %rax
+  push %rax
+ .loc 1 52
+ .loc 1 52
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 52
+ .loc 2 1
+ .loc 2 1
+ .loc 1 53
+  mov $8, %rax
+  push %rax
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+ .loc 1 53
+  mov $8, %rax
+  push %rax
+ .loc 1 53
+ .loc 1 53
+  lea .L..38(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 53
+ .loc 2 1
+ .loc 2 1
+ .loc 1 54
+  mov $1, %rax
+  push %rax
+ .loc 1 54
+ .loc 1 54
+ .loc 1 54
+ .loc 1 54
+ .loc 1 54
+  mov $1, %rax
+  push %rax
+ .loc 1 54
+ .loc 1 54
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 54
+ .loc 2 1
+ .loc 2 1
+ .loc 1 55
+  mov $3, %rax
+  push %rax
+ .loc 1 55
+ .loc 1 55
+ .loc 1 55
+ .loc 1 55
+ .loc 1 55
+  mov $3, %rax
+  push %rax
+ .loc 1 55
+ .loc 1 55
+  lea .L..40(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 55
+ .loc 2 1
+ .loc 2 1
+ .loc 1 56
+  mov $12, %rax
+  push %rax
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+ .loc 1 56
+  mov $12, %rax
+  push %rax
+ .loc 1 56
+ .loc 1 56
+  lea .L..41(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 56
+ .loc 2 1
+ .loc 2 1
+ .loc 1 57
+  mov $4, %rax
+  push %rax
+ .loc 1 57
+ .loc 1 57
+ .loc 1 57
+ .loc 1 57
+ .loc 1 57
+  mov $4, %rax
+  push %rax
+ .loc 1 57
+ .loc 1 57
+  lea .L..42(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 57
+ .loc 2 1
+ .loc 2 1
+ .loc 1 58
+  mov $3, %rax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+  mov $0, %rax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+  lea -48(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+  lea -20(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 58
+ .loc 1 58
+  lea -20(%rbp), %rax
+  push %rax
+ .loc 1 58
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+  mov $0, %rax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+ .loc 1 58
+  mov $0, %rax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+  lea -48(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 58
+ .loc 1 58
+  lea .L..43(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 58
+ .loc 2 1
+ .loc 2 1
+ .loc 1 59
+  mov $4, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+  lea -16(%rbp), %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  lea -19(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+  mov $0, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+  mov $0, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+ .loc 1 59
+  mov $4, %rax
+  pop %rdi
+  mov %al, (%rdi)
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+  mov $0, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+ .loc 1 59
+  mov $0, %rax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbl (%rax), %eax
+  push %rax
+ .loc 1 59
+ .loc 1 59
+  lea .L..44(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+ .loc 1 59
+ .loc 1 60
+ .loc 1 60
+ .loc 1 62
+ .loc 1 62
+ .loc 1 62
+  lea .L..45(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+ .loc 1 63
+ .loc 1 63
+  mov $0, %rax
+ jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
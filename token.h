@@ -1,10 +1,13 @@
 // Open_memstream is  POSIX function and its declaration isn't visible in the other program
 // https://stackoverflow.com/questions/14862513/open-memstream-warning-pointer-from-integer-without-a-cast
 #define _POSIX_C_SOURCE 200809L
+// MAP_ANONYMOUS is not part of POSIX
+#define _DEFAULT_SOURCE
 
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <ctype.h>
 #include <errno.h>
@@ -13,28 +16,94 @@
 #include <string.h>
 #include <strings.h>
 #include <stdarg.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <elf.h>
+#include <dlfcn.h>
 
 typedef struct Type Type;
 typedef struct Node Node;
 typedef struct Member Member;
+typedef struct Param Param;
 
 // strings.c
 char *format(char *fmt, ...);
 
+// intern.c
+char *intern(char *s, int len);
+
+// arena.c
+
+typedef struct ArenaChunk ArenaChunk;
+typedef struct ArenaBlock ArenaBlock;
+
+// A region of memory objects are bump-allocated from and freed all at once
+typedef struct Arena {
+        char *name; // Region name shown by --mem-stats
+        ArenaChunk *chunks; // Newest chunk first
+        char *ptr; // Next free byte in the newest chunk
+        char *end;
+        ArenaBlock *blocks; // Resizable blocks
+        size_t used; // Bytes handed out
+        size_t reserved; // Bytes obtained from malloc
+        size_t peak; // Most bytes reserved at once since release_all_arenas()
+} Arena;
+
+// Every compiler thread has its own set of regions
+extern _Thread_local Arena token_arena; // Tokens and string literal contents
+extern _Thread_local Arena node_arena; // AST nodes, local variables and block scopes
+extern _Thread_local Arena type_arena; // Types and struct members
+extern _Thread_local Arena symbol_arena; // Variables, functions and scopes
+extern _Thread_local Arena ir_arena; // -O1 code of the function being generated
+extern _Thread_local Arena header_arena; // Cached headers, kept until the process ends
+
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *s, size_t n);
+void *arena_resize_block(Arena *arena, void *p, size_t size);
+void arena_release(Arena *arena);
+Arena arena_detach(Arena *arena);
+void release_all_arenas(void);
+void print_mem_stats(FILE *out);
+
 // tokenizer.c 
 
 typedef struct File {
         char *name; // Original filename
         int unique_id; // Unique file num
         char *contents;
+        char *buffer; // Memory read_file() got the contents in, NULL if it is not owned
+        size_t mapped_size; // Length of the mapping of `buffer`, 0 if it was malloc'ed
 
         char *display_name; // Display name for error messages
         int line_number; // Line number delta
+
+        // Offset of the first character of each line, filled in by the lexer
+        int *line_offsets;
+        int line_count;
+        int line_capacity;
 } File;
 
 
 File *new_file(char* name, int file_num, char *contents);
 
+// scan.c
+
+typedef struct {
+        char *isa; // Instruction set the scanners were picked for
+        char *(*skip_blanks)(char *p); // Skip whitespace other than '\n'
+        char *(*skip_ident)(char *p); // Skip identifier characters
+        char *(*find_newline)(char *p); // Find '\n' or '\0'
+        char *(*find_comment_char)(char *p); // Find '*', '\n' or '\0'
+        char *(*find_string_char)(char *p); // Find '"', '\\', '\n' or '\0'
+} Scanner;
+
+extern Scanner scanner;
+
 typedef struct Token Token;
 
 typedef enum TokenType {
@@ -47,25 +116,103 @@ typedef enum TokenType {
         T_EOF,     // End-of-file markers
 } TokenType;
 
+// Keyword and punctuator IDs. The ID of a single-character punctuator
+// is the character itself, e.g. '(' or ';'. Multi-character punctuators
+// and keywords are numbered above the character range.
+enum {
+        TK_EQ = 256, // ==
+        TK_NE, // !=
+        TK_LE, // <=
+        TK_GE, // >=
+        TK_ARROW, // ->
+        TK_ADD_ASSIGN, // +=
+        TK_SUB_ASSIGN, // -=
+        TK_MUL_ASSIGN, // *=
+        TK_DIV_ASSIGN, // /=
+        TK_MOD_ASSIGN, // %=
+        TK_AND_ASSIGN, // &=
+        TK_OR_ASSIGN, // |=
+        TK_XOR_ASSIGN, // ^=
+        TK_INC, // ++
+        TK_DEC, // --
+        TK_LOGAND, // &&
+        TK_LOGOR, // ||
+        TK_HASHHASH, // ##
+        TK_ELLIPSIS, // ...
+
+        TK_RETURN,
+        TK_IF,
+        TK_ELSE,
+        TK_FOR,
+        TK_WHILE,
+        TK_INT,
+        TK_SIZEOF,
+        TK_CHAR,
+        TK_STRUCT,
+        TK_UNION,
+        TK_SHORT,
+        TK_LONG,
+        TK_VOID,
+        TK_TYPEDEF,
+        TK_BOOL, // _Bool
+        TK_ENUM,
+        TK_STATIC,
+        TK_ID_COUNT,
+};
+
+// Tokens of a file are stored in one contiguous array ending with a
+// T_EOF token, so the token after `token` is simply `token + 1`. A
+// token only holds what every token needs; the values of numeric and
+// string literals live in a side table (see token_literal()).
 typedef struct Token {
-        TokenType token_type; // Kind of Token
-        Token *next; // Next token
-        int64_t val; // If tokenType == T_NUM, its value
         char *loc; // Token location
+        union {
+                char *ident; // Interned spelling if T_IDENT or T_KEYWORD
+                int literal; // Index into the literal table if T_NUM or T_STR, below zero for cached headers
+        };
         int len; // Token length
-        Type *type; // Used if T_STR
-        char *str; // String literal contents including terminating '\0'
-
         int line_num;
+        int file_no; // Index into the input file table, below zero for cached headers
+        uint16_t id; // Keyword or punctuator ID, 0 for other tokens
+        uint8_t token_type; // Kind of Token
+        uint8_t flags; // TF_* flags
 } Token;
 
+enum {
+        TF_BOL = 1, // First token of a line
+        TF_SPACE = 2, // Preceded by whitespace
+        TF_NOEXPAND = 4, // Names a macro that must not be expanded
+};
+
+// Value of a numeric or string literal token
+typedef struct {
+        int64_t val; // If T_NUM, its value
+        char *str; // If T_STR, its contents including terminating '\0'
+        int str_len; // If T_STR, length of str including terminating '\0'
+} Literal;
+
 void error(char *fmt, ...);
 void error_at(char *location, char *fmt, ...);
 void error_tok(Token *token, char *fmt, ...);
 bool equal(Token *token, char *op);
-Token *skip(Token *token, char *op);
-bool consume(Token **rest, Token *token, char *str);
+Token *skip(Token *token, int id);
+bool consume(Token **rest, Token *token, int id);
+Literal *token_literal(Token *token);
+File *token_file(Token *token);
 Token *tokenize_file(char *filename);
+Token *tokenize_string(char *name, char *contents);
+Token *tokenize_scratch(char *name, char *contents);
+Token *tokenize_header(char *path);
+int unit_file_no(int file_no);
+File **get_input_files(void);
+void set_input_files(File **files);
+void reset_tokenizer(void);
+
+// preprocess.c
+Token *preprocess(Token *tokens);
+void add_include_path(char *dir);
+void print_tokens(Token *token, FILE *out);
+void reset_preprocessor(void);
 
 #define unreachable() \
         error("internal error at %s:%d", __FILE__, __LINE__);
@@ -81,16 +228,20 @@ struct Obj {
 
         // Local variable
         int offset; // offset from %rbp
+        bool is_address_taken; // Operand of unary & (set by gen_ir())
+        int vreg; // -O1 virtual register the variable is promoted to, 0 if in memory
 
         // Global variable or function
         bool is_function;
         bool is_definition;
         bool is_static;
+        bool is_referenced; // Named in a function body
 
         // Global variable
         char *init_data;
 
         // Function;
+        Token *body_token; // '{' of a body whose parsing is deferred
         Obj *params;
         Node *body;
         Obj *locals;
@@ -133,40 +284,71 @@ typedef enum {
         ND_CAST, // Type cast
 } NodeType;
 
-// AST Node type
+// AST Node type. Only the fields of the union member that belongs to
+// node_type are valid, which keeps a node at 64 bytes.
 typedef struct Node {
         NodeType node_type; // Type of Node
         Node *next; // Next Node
         Token *token; // Representative token
         Type *type; // Type, like int or pointer to int or char, etc.
 
-        Node *left; // left-side of AST
-        Node *right; // right-side of AST 
-
-        // "if" or "for" statement
-        Node *cond;
-        Node *then;
-        Node *els;
-        Node *init;
-        Node *inc;
-
-        // ND_BLOCK or statement expression
-        Node *body;
+        union {
+                // Operators, ND_RETURN, ND_STATEMENT, ND_CAST and ND_MEMBER
+                struct {
+                        Node *left; // left-side of AST
+                        union {
+                                Node *right; // right-side of AST
+                                Member *member; // Struct member access
+                        };
+                };
+
+                // "if" or "for" statement
+                struct {
+                        Node *cond;
+                        Node *then;
+                        union {
+                                Node *els; // ND_IF
+                                Node *init; // ND_FOR
+                        };
+                        Node *inc; // ND_FOR
+                };
+
+                // ND_BLOCK or statement expression
+                Node *body;
+
+                // Function call
+                struct {
+                        char *funcname;
+                        Type *func_type;
+                        Node *args;
+                };
+
+                int64_t val; // ND_NUM
+                Obj *var; // ND_VAR
+        };
+} Node;
 
-        // Struct member access
-        Member *member;
+// A file-scope name, as saved to and loaded from precompiled headers
+typedef struct {
+        char *name;
+        Obj *var; // Function or global variable
+        Type *type_def; // Typedef
+        Type *enum_type; // Enum constant
+        int enum_val;
+        Type *tag; // Struct, union or enum tag
+} GlobalName;
 
-        // Function call
-        char *funcname;
-        Type *func_type;
-        Node *args;
+Node *new_cast(Node *expr, Type *type);
+Obj *parse(Token *token, void (*done)(Obj *func), bool lazy);
+GlobalName *global_names(int *count);
+void define_global_name(GlobalName *name);
+void set_parser_optimization(int level);
+void reset_parser(void);
 
-        int64_t val; // Only used if NodeType == ND_NUM
-        Obj *var; // Only used if NodeType == ND_VAR
-} Node;
+// pch.c
 
-Node *new_cast(Node *expr, Type *type);
-Obj *parse(Token *token);
+void write_pch(char *path);
+void load_pch(char *path);
 
 // type.c
 
@@ -199,9 +381,6 @@ struct Type {
         // C spec. 
         Type *base;
 
-        // Declaration
-        Token *name;
-
         // Array
         int array_len;
 
@@ -210,8 +389,14 @@ struct Type {
 
         // Function type
         Type *return_type;
-        Type *params;
-        Type *next;
+        Param *params;
+};
+
+// Function parameter
+struct Param {
+        Param *next;
+        Type *type;
+        Token *name;
 };
 
 // struct
@@ -219,7 +404,7 @@ struct Member {
         Member *next;
         Type *type;
         Token *token; // for error message
-        Token *name;
+        char *name; // Interned member name
         int offset;
 };
 
@@ -232,27 +417,214 @@ extern Type *ty_int;
 extern Type *ty_long;
 
 bool is_integer(Type *type);
-Type *copy_type(Type *type);
 Type *pointer_to(Type *base);
 Type *func_type(Type *return_type);
 Type *array_of(Type *base, int size);
 Type *enum_type(void);
 Type *struct_type(void);
 void add_type(Node *node);
+void fold_constant(Node *node);
+void print_type_stats(FILE *out);
+void reset_types(void);
+
+// ir.c
+
+// Three-address code the -O1 code generator works on. Values live in an
+// unlimited number of virtual registers, numbered from 1, which
+// regalloc.c maps onto machine registers. Between gen_ir() and
+// leave_ssa() the code is in SSA form: every virtual register is
+// written by exactly one instruction.
+typedef enum {
+        IR_IMM, // dst = imm
+        IR_MOV, // dst = a
+        IR_ADD, // dst = a + b
+        IR_SUB, // dst = a - b
+        IR_MUL, // dst = a * b
+        IR_DIV, // dst = a / b
+        IR_MOD, // dst = a % b
+        IR_AND, // dst = a & b
+        IR_OR, // dst = a | b
+        IR_XOR, // dst = a ^ b
+        IR_EQ, // dst = a == b
+        IR_NE, // dst = a != b
+        IR_LT, // dst = a < b
+        IR_LE, // dst = a <= b
+        IR_NEG, // dst = -a
+        IR_BITNOT, // dst = ~a
+        IR_SEXT, // dst = a sign-extended from its low `size` bytes
+        IR_ADDR, // dst = address
+        IR_LOAD, // dst = *address
+        IR_STORE, // *address = b
+        IR_COPY, // Copy `size` bytes from where b points to address
+        IR_CALL, // dst = funcname(args...)
+        IR_PARAMS, // args... = the incoming parameters
+        IR_JMP, // goto then
+        IR_BR, // if (a) goto then; else goto els
+        IR_RET, // return a
+        IR_PHI, // dst = args[i] when coming from the block's preds[i]
+} IROp;
+
+typedef struct IRInst IRInst;
+typedef struct IRBlock IRBlock;
+
+struct IRInst {
+        IRInst *next;
+        IROp op;
+        int size; // Operand size in bytes
+        int file; // Source file, an index into the file table
+        int line; // Source line
+        int dst; // Virtual register written, 0 if none
+        int a; // Virtual registers read, 0 if none. A b of 0 in a binary
+        int b; // operation or IR_STORE stands for the constant imm.
+        int64_t imm;
+
+        // The address of IR_ADDR, IR_LOAD, IR_STORE and IR_COPY is
+        // var + offset, or a + offset if var is NULL
+        Obj *var;
+        int offset;
+
+        // IR_CALL, IR_PARAMS and IR_PHI
+        char *funcname;
+        int *args;
+        int nargs;
+
+        // IR_JMP and IR_BR
+        IRBlock *then;
+        IRBlock *els;
+};
+
+struct IRBlock {
+        IRBlock *next; // Next block in emission order
+        int id;
+        IRInst *insts;
+        IRInst *last;
+        IRBlock **preds; // Set by to_ssa()
+        int npreds;
+};
+
+typedef struct {
+        Obj *func;
+        IRBlock *blocks;
+        int block_count;
+        int vreg_count;
+        int *version_of; // Variable register each SSA value is a version of, 0 for temporaries
+
+        // Set by allocate_registers()
+        int *reg; // Machine register of each virtual register, -1 if spilled
+        int *spill; // Spill slot of each spilled virtual register
+        int spill_count;
+} IRFunc;
+
+IRFunc *gen_ir(Obj *func);
+int ir_uses(IRInst *inst, int *uses);
+int ir_defs(IRInst *inst, int *defs);
+int ir_successors(IRBlock *block, IRBlock **succ);
+bool ir_has_side_effects(IRInst *inst);
+void print_ir(IRFunc *func, FILE *out);
+void emit_ir(Obj *program, FILE *out);
+
+// ssa.c
+
+void to_ssa(IRFunc *func);
+void optimize_ir(IRFunc *func);
+void leave_ssa(IRFunc *func);
+
+// output.c
+
+typedef struct {
+        int fd; // -1 if the text is only kept in memory
+        char *buf;
+        size_t len;
+        size_t cap;
+} Output;
+
+Output *out_open(char *path);
+Output *out_memory(void);
+void out_close(Output *out);
+void out_flush(Output *out);
+void out_write(Output *out, char *s, size_t len);
+void out_putc(Output *out, char c);
+void out_vformat(Output *out, char *fmt, va_list ap);
+void out_format(Output *out, char *fmt, ...);
+void out_append(Output *out, Output *parts, int count);
+
+// assembler.c
+
+void assemble(char *text, size_t len, char *path);
+void load_library(char *path);
+int run_assembly(char *text, size_t len, int argc, char **argv);
+
+// peephole.c
+
+// Assembly of one function as lines of text, which the peephole
+// optimizer can delete or replace before they are written out
+typedef struct {
+        Output text; // The lines, each NUL-terminated
+        long *lines; // Offset of each line in text, or -1 if deleted
+        int count;
+        int lines_cap;
+} AsmBuffer;
+
+void asm_vprintf(AsmBuffer *buf, char *fmt, va_list ap);
+void asm_flush(AsmBuffer *buf, Output *out);
+void asm_free(AsmBuffer *buf);
+void peephole(AsmBuffer *buf);
+void print_peephole_stats(FILE *out);
+
+// regalloc.c
+
+// Machine registers. Caller-saved registers are handed out first;
+// values that live across a call only get callee-saved ones. RAX, RDX
+// and R11 are scratch registers of the code generator and never
+// allocated.
+typedef enum {
+        REG_RCX,
+        REG_RSI,
+        REG_RDI,
+        REG_R8,
+        REG_R9,
+        REG_R10,
+        REG_RBX,
+        REG_R12,
+        REG_R13,
+        REG_R14,
+        REG_R15,
+        REG_RAX,
+        REG_RDX,
+        REG_R11,
+        REG_COUNT,
+} Reg;
+
+#define REG_FIRST_CALLEE_SAVED REG_RBX
+#define REG_ALLOCATABLE REG_RAX
+
+void allocate_registers(IRFunc *func);
 
 // asmgen.c
 
-void gen_asm(Obj *program, FILE *out);
+void set_optimization(int level);
+void set_peephole(bool enabled);
+void gen_asm(Obj *program, Output *out, int jobs);
+void gen_function_text(Obj *func, Output *out);
+void gen_data(Obj *program, Output *out);
+void reset_codegen(void);
 int align_to(int n, int align);
 
 
-// Memory management
-// When exiting the program, OS frees automatically
-void free_node(Node *node); 
 
-void free_token(Token *token);
+// pool.c
+
+void run_jobs(int job_count, int worker_count, void (*run)(int job));
 
-void free_lvar(Obj *locals);
+#define QUEUE_SIZE 64
 
-void free_memory(Token *token, Obj *program);
+// Bounded lock-free queue between one producer and one consumer thread
+typedef struct {
+        void *items[QUEUE_SIZE];
+        _Atomic size_t head; // Next item to pop
+        _Atomic size_t tail; // Next free slot
+} Queue;
 
+void queue_push(Queue *queue, void *item);
+void *queue_pop(Queue *queue);
+void run_pipeline(void (*producer)(void *arg), void *(*consumer)(void *arg), void *arg);
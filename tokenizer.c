@@ -1,15 +1,63 @@
 #include "token.h"
+#include <pthread.h>
+
+// Lexer state is per thread: every thread compiles its own translation
+// units and reset_tokenizer() clears it between them.
+static _Thread_local File *current_file;
+
+// Line number the lexer is currently at
+static _Thread_local int current_line;
+
+// Flags for the next token: at the beginning of a line, after whitespace
+static _Thread_local bool at_bol;
+static _Thread_local bool has_space;
+
+// Compilers have to handle multiple input files at the same time.
+// Tokens refer to their file by its unique_id, an index into this table.
+static _Thread_local File **input_files;
+static _Thread_local int file_count;
+static _Thread_local int file_capacity;
+
+// Token array of the file being tokenized
+static _Thread_local Token *tokens;
+static _Thread_local int token_count;
+static _Thread_local int token_capacity;
+
+// File and token array tokenize_scratch() reuses
+static _Thread_local File *scratch_file;
+static _Thread_local Token *scratch_tokens;
+static _Thread_local int scratch_capacity;
+
+// Headers are lexed once per process by tokenize_header(). Their files
+// and literals go to tables shared by all threads and are numbered
+// below zero: file -1 is shared_files entry 0. Entries are added under
+// shared_lock and never move, so a thread that got hold of a header's
+// tokens can look them up without the lock.
+#define SHARED_CHUNK 4096
+#define SHARED_CHUNKS 4096
+
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+static File **shared_files[SHARED_CHUNKS];
+static int shared_file_count;
+static Literal *shared_literals[SHARED_CHUNKS];
+static int shared_literal_count;
+
+// Index of each shared file in the unit's file table, 0 if not in there
+static _Thread_local int *unit_file_nos;
+static _Thread_local int unit_file_capacity;
+
+// Set while tokenize_header() runs
+static _Thread_local bool lexing_header;
+
+// Region the file being lexed is allocated from
+static Arena *lex_arena(void) {
+        return lexing_header ? &header_arena : &token_arena;
+}
 
-
-static File *current_file;
-
-static char *current_filename;
-
-// temporary in order to test easier
-static char *current_input;
-
-// Compilers have to handle multiple input files at the same time
-static File **input_files;
+// Values of numeric and string literals of all files
+static _Thread_local Literal *literals;
+static _Thread_local int literal_count;
+static _Thread_local int literal_capacity;
 
 void error(char *fmt, ...) {
         va_list argument_pointer;
@@ -20,22 +68,49 @@ void error(char *fmt, ...) {
         exit(1);
 }
 
+// Records that a new line starts at `p`
+static void add_line(File *file, char *p) {
+        if (file->line_count == file->line_capacity) {
+                file->line_capacity = file->line_capacity ? file->line_capacity * 2 : 64;
+                file->line_offsets = arena_resize_block(lex_arena(), file->line_offsets,
+                                sizeof(int) * file->line_capacity);
+        }
+        file->line_offsets[file->line_count++] = p - file->contents;
+}
+
+// Returns the 1-based line number containing `location` by binary
+// searching the line start table of `file`
+static int find_line(File *file, char *location) {
+        int offset = location - file->contents;
+        int lo = 0, hi = file->line_count - 1;
+        while (lo < hi) {
+                int mid = (lo + hi + 1) / 2;
+                if (file->line_offsets[mid] <= offset)
+                        lo = mid;
+                else
+                        hi = mid - 1;
+        }
+        return lo + 1;
+}
+
 // Reports error message in following format
 //
 // main.c:10: x = y + 1;
 //                ^ <error message here>
-void verror_at(int line_num, char *location, char *fmt, va_list argument_pointer) {
+void verror_at(File *file, int line_num, char *location, char *fmt, va_list argument_pointer) {
         // Find a line containing `location`
-        char *line = location;
-        while (current_input < line && line[-1] != '\n')
-                line--;
+        char *line = file->contents + file->line_offsets[line_num - 1];
 
-        char *end = location;
-        while (*end != '\n')
+        char *end = line;
+        while (*end && *end != '\n')
                 end++;
 
+        // Tokens made up by the preprocessor point into text of their own
+        if (location < line || location > end)
+                location = line;
+
         // Print out the line
-        int indent = fprintf(stderr, "%s:%d: ", current_filename, line_num);
+        int indent = fprintf(stderr, "%s:%d: ", file->display_name, line_num);
         fprintf(stderr, "%.*s\n", (int) (end - line), line);
 
         // Show error message
@@ -48,76 +123,108 @@ void verror_at(int line_num, char *location, char *fmt, va_list argument_pointer
 }
 
 void error_at(char *location, char *fmt, ...) {
-        int line_num = 1;
-        for (char *p = current_input; p < location; p++)
-                if (*p == '\n')
-                        line_num++;
         va_list argument_pointer;
         va_start(argument_pointer, fmt);
-        verror_at(line_num, location, fmt, argument_pointer);
+        verror_at(current_file, find_line(current_file, location), location, fmt, argument_pointer);
         exit(1);
 }
 
 void error_tok(Token *token, char *fmt, ...) {
         va_list argument_pointer;
         va_start(argument_pointer, fmt);
-        verror_at(token->line_num, token->loc, fmt, argument_pointer);
+        verror_at(token_file(token), token->line_num, token->loc, fmt, argument_pointer);
         exit(1);
 }
 
-static void add_line_numbers(Token *token) {
-        char *p = current_input;
-        int n = 1;
-        do {
-                if (p == token->loc) {
-                        token->line_num = n;
-                        token = token->next;
-                }
-                if (*p == '\n')
-                        n++;
-        } while(*p++);
-}
-
-
-void free_token(Token *token) {
-        if (!token) return;
-        free_token(token->next);
-        free(token);
-}
-
 bool equal(Token *token, char *op) {
         return memcmp(token->loc, op, token->len) == 0 && op[token->len] == '\0';
 }
 
-Token *skip(Token *token, char *s) {
-        if (!equal(token, s))
-                error_tok(token, "expected '%s'", s);
-        return token->next;
+static char *spellings[] = {
+        [TK_EQ] = "==", [TK_NE] = "!=", [TK_LE] = "<=", [TK_GE] = ">=",
+        [TK_ARROW] = "->", [TK_ADD_ASSIGN] = "+=", [TK_SUB_ASSIGN] = "-=",
+        [TK_MUL_ASSIGN] = "*=", [TK_DIV_ASSIGN] = "/=", [TK_MOD_ASSIGN] = "%=",
+        [TK_AND_ASSIGN] = "&=", [TK_OR_ASSIGN] = "|=", [TK_XOR_ASSIGN] = "^=",
+        [TK_INC] = "++", [TK_DEC] = "--", [TK_LOGAND] = "&&", [TK_LOGOR] = "||",
+        [TK_HASHHASH] = "##", [TK_ELLIPSIS] = "...",
+
+        [TK_RETURN] = "return", [TK_IF] = "if", [TK_ELSE] = "else", [TK_FOR] = "for",
+        [TK_WHILE] = "while", [TK_INT] = "int", [TK_SIZEOF] = "sizeof", [TK_CHAR] = "char",
+        [TK_STRUCT] = "struct", [TK_UNION] = "union", [TK_SHORT] = "short", [TK_LONG] = "long",
+        [TK_VOID] = "void", [TK_TYPEDEF] = "typedef", [TK_BOOL] = "_Bool", [TK_ENUM] = "enum",
+        [TK_STATIC] = "static",
+};
+
+Token *skip(Token *token, int id) {
+        if (token->id != id) {
+                if (id < 256)
+                        error_tok(token, "expected '%c'", id);
+                error_tok(token, "expected '%s'", spellings[id]);
+        }
+        return token + 1;
 }
 
-bool consume(Token **rest, Token *token, char *str) {
-        if (equal(token, str)) {
-                *rest = token->next;
+bool consume(Token **rest, Token *token, int id) {
+        if (token->id == id) {
+                *rest = token + 1;
                 return true;
         }
         *rest = token;
         return false;
 }
 
+Literal *token_literal(Token *token) {
+        if (token->literal >= 0)
+                return &literals[token->literal];
+        int i = -token->literal - 1;
+        return &shared_literals[i / SHARED_CHUNK][i % SHARED_CHUNK];
+}
+
+static File *shared_file(int file_no) {
+        int i = -file_no - 1;
+        return shared_files[i / SHARED_CHUNK][i % SHARED_CHUNK];
+}
+
+File *token_file(Token *token) {
+        return token->file_no >= 0 ? input_files[token->file_no] : shared_file(token->file_no);
+}
+
+// Threads that generate code for tokens another thread read borrow its
+// file table, so that their error messages can point into the source
+File **get_input_files(void) {
+        return input_files;
+}
+
+void set_input_files(File **files) {
+        input_files = files;
+}
+
+// Appends a token to the token array. The returned pointer is only
+// valid until the next token is added.
 static Token *new_token(TokenType type, char *start, char *end) {
-        Token *token = calloc(1, sizeof(Token));
-        if (token == NULL) {
-                error("not enough memory in system");
+        if (token_count == token_capacity) {
+                token_capacity = token_capacity ? token_capacity * 2 : 4096;
+                tokens = arena_resize_block(lex_arena(), tokens, sizeof(Token) * token_capacity);
         }
 
+        Token *token = &tokens[token_count++];
         token->token_type = type;
         token->loc = start;
         token->len = end - start;
+        token->file_no = current_file->unique_id;
+        token->line_num = current_line;
+        token->flags = (at_bol ? TF_BOL : 0) | (has_space ? TF_SPACE : 0);
+        at_bol = has_space = false;
         return token;
 }
 
-static bool startswith(char *p, char *q) {
-        return strncmp(p, q, strlen(q)) == 0;
+static Literal *new_literal(Token *token) {
+        if (literal_count == literal_capacity) {
+                literal_capacity = literal_capacity ? literal_capacity * 2 : 1024;
+                literals = arena_resize_block(&token_arena, literals, sizeof(Literal) * literal_capacity);
+        }
+        token->literal = literal_count;
+        return &literals[literal_count++];
 }
 
 // Returns true if c is valid as the first character of an identifier 
@@ -125,11 +232,6 @@ static bool is_valid_ident_first_character(char c) {
         return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
 }
 
-// Returns true if c is valid as a non-first character of an identifier
-static bool is_valid_ident_character(char c) {
-        return is_valid_ident_first_character(c) || ('0' <= c && c <= '9');
-}
-
 static int from_hex(char c) {
         if ('0' <= c && c <= '9')
                 return c - '0';
@@ -138,32 +240,114 @@ static int from_hex(char c) {
         return c - 'A' + 10;
 }
 
-// Returns length of punctuator token from p
-static int get_punct_length(char *p) {
-        static char *puncts[] = {
-                "==", "!=", "<=", ">=", "->", "+=", "-=", "*=", "/=", "++", "--", 
-                "%=", "&=", "|=", "^=", "&&", "||",
-        };
-
-        for (int i = 0; i < sizeof(puncts) / sizeof(*puncts); i++)
-                if (startswith(p, puncts[i]))
-                        return strlen(puncts[i]);
+// Returns length of punctuator token from p and sets its ID
+static int read_punct(char *p, int *id) {
+        switch (*p) {
+                case '=':
+                        if (p[1] == '=') { *id = TK_EQ; return 2; }
+                        break;
+                case '!':
+                        if (p[1] == '=') { *id = TK_NE; return 2; }
+                        break;
+                case '<':
+                        if (p[1] == '=') { *id = TK_LE; return 2; }
+                        break;
+                case '>':
+                        if (p[1] == '=') { *id = TK_GE; return 2; }
+                        break;
+                case '-':
+                        if (p[1] == '>') { *id = TK_ARROW; return 2; }
+                        if (p[1] == '=') { *id = TK_SUB_ASSIGN; return 2; }
+                        if (p[1] == '-') { *id = TK_DEC; return 2; }
+                        break;
+                case '+':
+                        if (p[1] == '=') { *id = TK_ADD_ASSIGN; return 2; }
+                        if (p[1] == '+') { *id = TK_INC; return 2; }
+                        break;
+                case '*':
+                        if (p[1] == '=') { *id = TK_MUL_ASSIGN; return 2; }
+                        break;
+                case '/':
+                        if (p[1] == '=') { *id = TK_DIV_ASSIGN; return 2; }
+                        break;
+                case '%':
+                        if (p[1] == '=') { *id = TK_MOD_ASSIGN; return 2; }
+                        break;
+                case '&':
+                        if (p[1] == '=') { *id = TK_AND_ASSIGN; return 2; }
+                        if (p[1] == '&') { *id = TK_LOGAND; return 2; }
+                        break;
+                case '|':
+                        if (p[1] == '=') { *id = TK_OR_ASSIGN; return 2; }
+                        if (p[1] == '|') { *id = TK_LOGOR; return 2; }
+                        break;
+                case '^':
+                        if (p[1] == '=') { *id = TK_XOR_ASSIGN; return 2; }
+                        break;
+                case '#':
+                        if (p[1] == '#') { *id = TK_HASHHASH; return 2; }
+                        break;
+                case '.':
+                        if (p[1] == '.' && p[2] == '.') { *id = TK_ELLIPSIS; return 3; }
+                        break;
+        }
 
+        *id = (unsigned char)*p;
         return ispunct(*p) ? 1 : 0;
 }
 
-static bool is_keyword(Token *token) {
-        static char *keywords[] = {
-                "return", "if", "else", "for", "while", "int", "sizeof", "char",
-                "struct", "union", "short", "long", "void", "typedef", "_Bool",
-                "enum", "static",
-        };
+// Returns the keyword ID of the identifier at p, or 0 if it is not a keyword.
+// Switching on the first character leaves at most a few candidates to compare.
+static int keyword_id(char *p, int len) {
+#define KEYWORD(str, id) \
+        if (len == sizeof(str) - 1 && !memcmp(p, str, len)) \
+                return id;
 
-        for (int i = 0; i < sizeof(keywords) / sizeof(*keywords); i++) {
-                if (equal(token, keywords[i]))
-                        return true;
+        switch (*p) {
+                case '_':
+                        KEYWORD("_Bool", TK_BOOL);
+                        break;
+                case 'c':
+                        KEYWORD("char", TK_CHAR);
+                        break;
+                case 'e':
+                        KEYWORD("else", TK_ELSE);
+                        KEYWORD("enum", TK_ENUM);
+                        break;
+                case 'f':
+                        KEYWORD("for", TK_FOR);
+                        break;
+                case 'i':
+                        KEYWORD("if", TK_IF);
+                        KEYWORD("int", TK_INT);
+                        break;
+                case 'l':
+                        KEYWORD("long", TK_LONG);
+                        break;
+                case 'r':
+                        KEYWORD("return", TK_RETURN);
+                        break;
+                case 's':
+                        KEYWORD("short", TK_SHORT);
+                        KEYWORD("sizeof", TK_SIZEOF);
+                        KEYWORD("static", TK_STATIC);
+                        KEYWORD("struct", TK_STRUCT);
+                        break;
+                case 't':
+                        KEYWORD("typedef", TK_TYPEDEF);
+                        break;
+                case 'u':
+                        KEYWORD("union", TK_UNION);
+                        break;
+                case 'v':
+                        KEYWORD("void", TK_VOID);
+                        break;
+                case 'w':
+                        KEYWORD("while", TK_WHILE);
+                        break;
         }
-        return false;
+        return 0;
+#undef KEYWORD
 }
 
 static int read_escaped_char(char **new_pos, char *p) {
@@ -221,18 +405,20 @@ static int read_escaped_char(char **new_pos, char *p) {
 // Find a closing double-quote.
 static char *string_literal_end(char *p) {
         char *start = p;
-        for (; *p != '"'; p++) {
-                if (*p == '\n' || *p == '\0')
+        for (;;) {
+                p = scanner.find_string_char(p);
+                if (*p == '"')
+                        return p;
+                if (*p == '\n' || *p == '\0' || p[1] == '\0')
                         error_at(start, "unclosed string literal");
-                if (*p == '\\')
-                        p++;
+                // Skip a backslash and the character it escapes
+                p += 2;
         }
-        return p;
 }
 
 static Token *read_string_literal(char *start) {
         char *end = string_literal_end(start + 1);
-        char *buf = calloc(1, end - start);
+        char *buf = arena_alloc(lex_arena(), end - start);
         int len = 0;
 
 
@@ -245,8 +431,9 @@ static Token *read_string_literal(char *start) {
         }
 
         Token *token = new_token(T_STR, start, end + 1);
-        token->type = array_of(ty_char, len + 1);
-        token->str = buf;
+        Literal *literal = new_literal(token);
+        literal->str = buf;
+        literal->str_len = len + 1;
         return token;
 }
 
@@ -266,7 +453,7 @@ static Token *read_char_literal(char *start) {
                 error_at(p, "unclosed char literal");
 
         Token *token = new_token(T_NUM, start, end + 1);
-        token->val = c;
+        new_literal(token)->val = c;
         return token;
 }
 
@@ -289,64 +476,87 @@ static Token *read_int_literal(char *start) {
                 error_at(p, "invalid digit");
 
         Token *token = new_token(T_NUM, start, p);
-        token->val = val;
+        new_literal(token)->val = val;
         return token;
 }
 
-static void identify_keywords(Token *token) {
-        for (Token *curr = token; curr->token_type != T_EOF; curr = curr->next) 
-                if (is_keyword(curr)) 
-                        curr->token_type = T_KEYWORD;
-}
-
-// Tokenize 'current_file' and returns new tokens
-static Token *tokenize(char *filename, char *p) {
-        current_filename = filename;
-        current_input = p;
-        Token head = {};
-        Token *cur = &head;
+// Appends the tokens of `file` to the token array. Line numbers are
+// assigned as tokens are created and the file's line start table is
+// filled in as newlines are skipped, so no second pass over the input is
+// needed.
+static void lex(File *file) {
+        char *p = file->contents;
+        current_file = file;
+        current_line = 1;
+        at_bol = true;
+        has_space = false;
+        add_line(file, p);
+        Token *cur;
 
         while (*p) {
                 // Skip line comments
-                if (startswith(p, "//")) {
-                        p += 2;
-                        while (*p != '\n')
-                                p++;
+                if (p[0] == '/' && p[1] == '/') {
+                        p = scanner.find_newline(p + 2);
+                        has_space = true;
                         continue;
                 }
 
                 // Skip block comments
-                if (startswith(p, "/*")) {
-                        char *substring = strstr(p + 2, "*/");
-                        if (!substring)
-                                error_at(p, "unclosed block comment");
-                        p = substring + 2;
+                if (p[0] == '/' && p[1] == '*') {
+                        char *q = p + 2;
+                        for (;;) {
+                                q = scanner.find_comment_char(q);
+                                if (*q == '*' && q[1] == '/')
+                                        break;
+                                if (*q == '\0')
+                                        error_at(p, "unclosed block comment");
+                                if (*q == '\n') {
+                                        add_line(file, q + 1);
+                                        current_line++;
+                                }
+                                q++;
+                        }
+                        p = q + 2;
+                        has_space = true;
+                        continue;
+                }
+
+                // Newlines are handled one at a time so the line table
+                // stays up to date; the indentation after them is skipped
+                // in bulk below
+                if (*p == '\n') {
+                        add_line(file, p + 1);
+                        current_line++;
+                        at_bol = true;
+                        has_space = false;
+                        p++;
                         continue;
                 }
 
                 // Skip whitespace characters
                 if (isspace(*p)) {
-                        p++;
+                        p = scanner.skip_blanks(p);
+                        has_space = true;
                         continue;
                 }
 
                 // Numeric literal
                 if (isdigit(*p)) {
-                        cur = cur->next = read_int_literal(p);
+                        cur = read_int_literal(p);
                         p += cur->len;
                         continue;
                 }
 
                 // String literal
                 if (*p == '"') {
-                        cur = cur->next = read_string_literal(p);
+                        cur = read_string_literal(p);
                         p += cur->len;
                         continue;
                 }
 
                 // Character literal
                 if (*p == '\'') {
-                        cur = cur->next = read_char_literal(p);
+                        cur = read_char_literal(p);
                         p += cur->len;
                         continue;
                 }
@@ -354,30 +564,41 @@ static Token *tokenize(char *filename, char *p) {
                 // Identifier or keyword
                 if (is_valid_ident_first_character(*p)) {
                         char *start = p;
-                        do {
-                                p++;
-                        } while (is_valid_ident_character(*p));
-                        cur = cur->next = new_token(T_IDENT, start, p);
+                        p = scanner.skip_ident(p + 1);
+                        cur = new_token(T_IDENT, start, p);
+                        cur->ident = intern(start, p - start);
+                        cur->id = keyword_id(start, p - start);
+                        if (cur->id)
+                                cur->token_type = T_KEYWORD;
                         continue;
                 }
 
                 // Punctuator
-                int punct_len = get_punct_length(p);
+                int id;
+                int punct_len = read_punct(p, &id);
                 if (punct_len) {
-                        cur = cur->next = new_token(T_PUNCT, p, p + punct_len);
+                        cur = new_token(T_PUNCT, p, p + punct_len);
+                        cur->id = id;
                         p += punct_len;
                         continue;
                 }
                 error_at(p, "invalid token");
         }
-        cur = cur->next = new_token(T_EOF, p, p);
-        add_line_numbers(head.next);
-        identify_keywords(head.next);
-        return head.next;
+        new_token(T_EOF, p, p);
+}
+
+// Tokenize `file` and returns its token array
+static Token *tokenize(File *file) {
+        tokens = NULL;
+        token_count = token_capacity = 0;
+        lex(file);
+
+        // Tokens are not added anymore, so give back the unused capacity
+        return arena_resize_block(lex_arena(), tokens, sizeof(Token) * token_count);
 }
 
 File *new_file(char* name, int file_num, char *contents) {
-        File *file = calloc(1, sizeof(File));
+        File *file = arena_alloc(lex_arena(), sizeof(File));
         file->name = name;
         file->unique_id = file_num;
         file->display_name = name;
@@ -385,17 +606,30 @@ File *new_file(char* name, int file_num, char *contents) {
         return file;
 }
 
-static char *read_file(char* path) {
-        FILE *file_path;
-
-        if (strcmp(path, "-") == 0) {
-                // If a given file name is "-", read from stdin
-                // Source: https://github.com/nektos/act/issues/998
-                file_path = stdin;
-        } else {
-                file_path = fopen(path, "r");
-                if (file_path == NULL) return NULL;
+// Maps a regular file read-only so the lexer works on the page cache
+// directly instead of on a copy. The mapping is followed by at least one
+// zero-filled page, which acts as the terminating '\0' sentinel.
+static char *map_file(int fd, size_t size, size_t *mapped_size) {
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t len = (size + page - 1) / page * page + page;
+
+        // Reserve zero pages for the whole range first, then put the file
+        // over the front of it. The tail of the last file page is zero-filled
+        // by the kernel.
+        char *buf = mmap(NULL, len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buf == MAP_FAILED)
+                return NULL;
+        if (size && mmap(buf, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                munmap(buf, len);
+                return NULL;
         }
+        *mapped_size = len;
+        return buf;
+}
+
+// Reads a whole stream into memory. Used for stdin and pipes, which
+// cannot be mapped.
+static char *read_stream(FILE *file_path) {
         char *buf;
         size_t buflen;
         FILE *out = open_memstream(&buf, &buflen);
@@ -409,35 +643,207 @@ static char *read_file(char* path) {
                 fwrite(buf2, sizeof(char), num_full_items, out);
         }
 
-        if (file_path != stdin) 
+        fputc('\0', out);
+        fclose(out);
+        return buf;
+}
+
+// Reads the file at `path`. `mapped_size` is set to the length of the
+// mapping if the file was mapped and to 0 if it was read into memory.
+static char *read_file(char* path, size_t *mapped_size) {
+        *mapped_size = 0;
+        if (strcmp(path, "-") == 0) {
+                // If a given file name is "-", read from stdin
+                // Source: https://github.com/nektos/act/issues/998
+                return read_stream(stdin);
+        }
+
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+                return NULL;
+
+        char *buf = NULL;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+                buf = map_file(fd, st.st_size, mapped_size);
+
+        if (!buf) {
+                FILE *file_path = fdopen(fd, "r");
+                if (file_path == NULL) {
+                        close(fd);
+                        return NULL;
+                }
+                buf = read_stream(file_path);
                 fclose(file_path);
-        // Last line should end with '\n'
-        fflush(out);
-        if (buflen == 0 || buf[buflen - 1] != '\n') {
-                fputc('\n', out);
+                return buf;
         }
 
-        fputc('\0', out);
-        fclose(out);
+        // The mapping stays valid after the descriptor is closed
+        close(fd);
         return buf;
 }
 
+// Appends `file` to the file table and returns its index. The table
+// always ends with a NULL entry.
+static int add_file_entry(File *file) {
+        if (file_count + 2 >= file_capacity) {
+                file_capacity = file_capacity ? file_capacity * 2 : 64;
+                input_files = arena_resize_block(&token_arena, input_files, sizeof(File *) * file_capacity);
+        }
+        input_files[++file_count] = file;
+        return file_count;
+}
+
+// Registers a new input file in the file table
+static File *add_file(char *name, char *contents) {
+        File *file = new_file(name, file_count + 1, contents);
+        add_file_entry(file);
+        return file;
+}
+
+// Returns the number a token of file `file_no` has in the unit's file
+// table. A shared header gets an entry there the first time one of its
+// tokens is used.
+int unit_file_no(int file_no) {
+        if (file_no >= 0)
+                return file_no;
+
+        int i = -file_no - 1;
+        if (i >= unit_file_capacity) {
+                int capacity = unit_file_capacity ? unit_file_capacity : 64;
+                while (capacity <= i)
+                        capacity *= 2;
+                unit_file_nos = realloc(unit_file_nos, sizeof(int) * capacity);
+                memset(unit_file_nos + unit_file_capacity, 0, sizeof(int) * (capacity - unit_file_capacity));
+                unit_file_capacity = capacity;
+        }
+        if (!unit_file_nos[i])
+                unit_file_nos[i] = add_file_entry(shared_file(file_no));
+        return unit_file_nos[i];
+}
+
+// Adds `file` to the shared file table and returns its number
+static int share_file(File *file) {
+        pthread_mutex_lock(&shared_lock);
+        int i = shared_file_count++;
+        if (i == SHARED_CHUNK * SHARED_CHUNKS)
+                error("too many header files");
+        if (!shared_files[i / SHARED_CHUNK])
+                shared_files[i / SHARED_CHUNK] = calloc(SHARED_CHUNK, sizeof(File *));
+        shared_files[i / SHARED_CHUNK][i % SHARED_CHUNK] = file;
+        pthread_mutex_unlock(&shared_lock);
+        return -i - 1;
+}
+
+// Moves the literals of `tokens` from the unit's literal table, where
+// the lexer put them starting at index `first`, to the shared one
+static void share_literals(Token *tokens, int first) {
+        pthread_mutex_lock(&shared_lock);
+        int base = shared_literal_count;
+        for (int i = first; i < literal_count; i++) {
+                int j = shared_literal_count++;
+                if (j == SHARED_CHUNK * SHARED_CHUNKS)
+                        error("too many literals in header files");
+                if (!shared_literals[j / SHARED_CHUNK])
+                        shared_literals[j / SHARED_CHUNK] = calloc(SHARED_CHUNK, sizeof(Literal));
+                shared_literals[j / SHARED_CHUNK][j % SHARED_CHUNK] = literals[i];
+        }
+        pthread_mutex_unlock(&shared_lock);
+
+        for (Token *token = tokens; token->token_type != T_EOF; token++)
+                if (token->token_type == T_NUM || token->token_type == T_STR)
+                        token->literal = -(base + token->literal - first) - 1;
+        literal_count = first;
+}
+
 Token *tokenize_file(char *path) {
-        char *p = read_file(path);
-        if (!p) return NULL;
+        size_t mapped_size;
+        char *buf = read_file(path, &mapped_size);
+        if (!buf) return NULL;
         // UTF-8 text might have a 3-byte long BOM: https://en.wikipedia.org/wiki/Byte_order_mark#Byte-order_marks_by_encoding
         // This statement skips it 
+        char *p = buf;
         if (!memcmp(p, "\xef\xbb\xbf", 3))
                 p += 3;
 
-        /*static int file_num;
-          File* file = new_file(path, file_num + 1, p);
+        File *file = add_file(path, p);
+        file->buffer = buf;
+        file->mapped_size = mapped_size;
+        return tokenize(file);
+}
 
-          DONT USE THIS CODE RN ITS BROKEN
-          input_files = realloc(input_files, sizeof(char *) * (file_num + 2));
-          input_files[file_num] = file;
-          input_files[file_num + 1] = NULL;
-          file_num++;*/
+// Tokenizes a header for the process-wide header cache. The file, its
+// tokens and its literals are shared with every thread and never freed,
+// and the tokens refer to them by negative numbers.
+Token *tokenize_header(char *path) {
+        size_t mapped_size;
+        char *buf = read_file(path, &mapped_size);
+        if (!buf) return NULL;
+        char *p = buf;
+        if (!memcmp(p, "\xef\xbb\xbf", 3))
+                p += 3;
 
-        return tokenize(path, p);
+        lexing_header = true;
+        File *file = new_file(path, 0, p);
+        file->buffer = buf;
+        file->mapped_size = mapped_size;
+        file->unique_id = share_file(file);
+
+        int first_literal = literal_count;
+        Token *tokens = tokenize(file);
+        share_literals(tokens, first_literal);
+        lexing_header = false;
+        return tokens;
+}
+
+// Tokenizes text the preprocessor made up, like the result of pasting
+// two tokens together. `name` is used in error messages.
+Token *tokenize_string(char *name, char *contents) {
+        return tokenize(add_file(name, contents));
+}
+
+// Like tokenize_string(), but for the many short texts of ## and #. They
+// are all lexed as one file, and the returned tokens are only valid
+// until the next call.
+Token *tokenize_scratch(char *name, char *contents) {
+        if (!scratch_file)
+                scratch_file = add_file("<scratch>", contents);
+        scratch_file->display_name = name;
+        scratch_file->contents = contents;
+        scratch_file->line_count = 0;
+
+        tokens = scratch_tokens;
+        token_count = 0;
+        token_capacity = scratch_capacity;
+        lex(scratch_file);
+        scratch_tokens = tokens;
+        scratch_capacity = token_capacity;
+        return tokens;
+}
+
+// Unmaps or frees the contents of every input file and forgets them.
+// The tokens themselves go away with token_arena.
+void reset_tokenizer(void) {
+        for (int i = 1; i <= file_count; i++) {
+                File *file = input_files[i];
+                if (file->unique_id < 0)
+                        continue;
+                if (file->mapped_size)
+                        munmap(file->buffer, file->mapped_size);
+                else
+                        free(file->buffer);
+        }
+        current_file = NULL;
+        scratch_file = NULL;
+        scratch_tokens = NULL;
+        scratch_capacity = 0;
+        free(unit_file_nos);
+        unit_file_nos = NULL;
+        unit_file_capacity = 0;
+        input_files = NULL;
+        file_count = file_capacity = 0;
+        tokens = NULL;
+        token_count = token_capacity = 0;
+        literals = NULL;
+        literal_count = literal_capacity = 0;
 }
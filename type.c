@@ -9,9 +9,7 @@ Type *ty_int = &(Type) {TY_INT, 4, 4};
 Type *ty_long = &(Type) {TY_LONG, 8, 8};
 
 static Type *new_type(TypeKind kind, int size, int align) {
-        Type *type = calloc(1, sizeof(Type));
-        if (type == NULL) 
-                error("not enough memory in system to allocate for type");
+        Type *type = arena_alloc(&type_arena, sizeof(Type));
         type->kind = kind;
         type->size = size;
         type->align = align;
@@ -24,32 +22,75 @@ bool is_integer(Type *type) {
                 k == TY_INT || k == TY_LONG || k == TY_ENUM;
 }
 
-Type *copy_type(Type *type) {
-        Type *ret = calloc(1, sizeof(Type));
-        if (ret == NULL)
-                error("Not enough memory in system to create type");
-        *ret = *type;
-        return ret;
+// Pointer and array types are hash-consed: there is exactly one "pointer
+// to T" per T and one "array of n T" per (T, n), so two derived types are
+// the same if and only if they are the same object.
+static _Thread_local Type **derived_types;
+static _Thread_local int derived_capacity;
+static _Thread_local int derived_count;
+
+static uint32_t derived_hash(TypeKind kind, Type *base, int len) {
+        uint64_t h = ((uintptr_t)base >> 4) * 0x9e3779b97f4a7c15ull;
+        h ^= (uint64_t)(uint32_t)len * 0xc2b2ae3d27d4eb4full + kind;
+        return h ^ (h >> 32);
 }
 
-Type *pointer_to(Type *base) {
-        Type *type = new_type(TY_PTR, 8, 8);
+static void rehash_derived_types(void) {
+        Type **old = derived_types;
+        int old_capacity = derived_capacity;
+
+        derived_capacity = derived_capacity ? derived_capacity * 2 : 1024;
+        derived_types = arena_alloc(&type_arena, sizeof(Type *) * derived_capacity);
+        for (int i = 0; i < old_capacity; i++) {
+                Type *type = old[i];
+                if (!type)
+                        continue;
+                int j = derived_hash(type->kind, type->base, type->array_len) & (derived_capacity - 1);
+                while (derived_types[j])
+                        j = (j + 1) & (derived_capacity - 1);
+                derived_types[j] = type;
+        }
+}
+
+// Returns the canonical `kind` type derived from `base`, creating it
+// if it does not exist yet
+static Type *derived_type(TypeKind kind, Type *base, int len) {
+        // Keep the load factor under 1/2
+        if ((derived_count + 1) * 2 > derived_capacity)
+                rehash_derived_types();
+
+        int i = derived_hash(kind, base, len) & (derived_capacity - 1);
+        for (; derived_types[i]; i = (i + 1) & (derived_capacity - 1)) {
+                Type *type = derived_types[i];
+                if (type->kind == kind && type->base == base && type->array_len == len)
+                        return type;
+        }
+
+        Type *type;
+        if (kind == TY_PTR) {
+                type = new_type(TY_PTR, 8, 8);
+        } else {
+                type = new_type(TY_ARRAY, base->size * len, base->align);
+                type->array_len = len;
+        }
         type->base = base;
+        derived_types[i] = type;
+        derived_count++;
         return type;
 }
 
-Type *func_type(Type *return_type) {
-        Type *type = calloc(1, sizeof(Type));
-        if (type == NULL)
-                error("Not enough memory in system");
-        type->kind = TY_FUNC;
-        type->return_type = return_type;
+Type *pointer_to(Type *base) {
+        return derived_type(TY_PTR, base, 0);
 }
 
 Type *array_of(Type *base, int len) {
-        Type *type = new_type(TY_ARRAY, base->size * len, base->align);
-        type->base = base;
-        type->array_len = len;
+        return derived_type(TY_ARRAY, base, len);
+}
+
+Type *func_type(Type *return_type) {
+        Type *type = arena_alloc(&type_arena, sizeof(Type));
+        type->kind = TY_FUNC;
+        type->return_type = return_type;
         return type;
 }
 
@@ -61,6 +102,8 @@ Type *struct_type(void) {
         return new_type(TY_STRUCT, 0 , 1);
 }
 
+static void set_type(Node *node);
+
 static Type *get_common_type(Type *type1, Type *type2) {
         if (type1->base)
                 return pointer_to(type1->base);
@@ -77,22 +120,175 @@ static void usual_arithmetic_conversion(Node **left, Node **right) {
         *right = new_cast(*right, type);
 }
 
+// Wraps `val` around to the range of the integer type `type`
+static int64_t wrap_to_type(Type *type, int64_t val) {
+        switch (type->kind) {
+                case TY_BOOL:
+                        return val != 0;
+                case TY_CHAR:
+                        return (int8_t)val;
+                case TY_SHORT:
+                        return (int16_t)val;
+                case TY_INT:
+                case TY_ENUM:
+                        return (int32_t)val;
+        }
+        return val;
+}
+
+// Evaluates an operation on numbers. Arithmetic is done on 64 bits and
+// wrapped to the result type afterwards. Division by zero is left to
+// trap at run time.
+static bool eval_op(NodeType op, uint64_t l, uint64_t r, uint64_t *val) {
+        switch (op) {
+                case ND_NEG:
+                        *val = -l;
+                        return true;
+                case ND_NOT:
+                        *val = !l;
+                        return true;
+                case ND_BITNOT:
+                        *val = ~l;
+                        return true;
+                case ND_CAST:
+                        *val = l;
+                        return true;
+                case ND_ADD:
+                        *val = l + r;
+                        return true;
+                case ND_SUB:
+                        *val = l - r;
+                        return true;
+                case ND_MUL:
+                        *val = l * r;
+                        return true;
+                case ND_DIV:
+                case ND_MOD:
+                        if (r == 0 || ((int64_t)l == INT64_MIN && (int64_t)r == -1))
+                                return false;
+                        *val = op == ND_DIV ? (int64_t)l / (int64_t)r : (int64_t)l % (int64_t)r;
+                        return true;
+                case ND_BITAND:
+                        *val = l & r;
+                        return true;
+                case ND_BITOR:
+                        *val = l | r;
+                        return true;
+                case ND_BITXOR:
+                        *val = l ^ r;
+                        return true;
+                case ND_EQ:
+                        *val = l == r;
+                        return true;
+                case ND_NE:
+                        *val = l != r;
+                        return true;
+                case ND_LT:
+                        *val = (int64_t)l < (int64_t)r;
+                        return true;
+                case ND_LE:
+                        *val = (int64_t)l <= (int64_t)r;
+                        return true;
+                case ND_LOGAND:
+                        *val = l && r;
+                        return true;
+                case ND_LOGOR:
+                        *val = l || r;
+                        return true;
+        }
+        return false;
+}
+
+// Replaces an integer operation whose operands are all numbers by the
+// number it evaluates to. Operands are typed, and so folded, before the
+// operations that use them, so a whole constant expression collapses
+// bottom-up into one ND_NUM of the expression's type.
+void fold_constant(Node *node) {
+        if (!node->type || !is_integer(node->type))
+                return;
+
+        uint64_t l, r = 0, val;
+        switch (node->node_type) {
+                case ND_NEG:
+                case ND_NOT:
+                case ND_BITNOT:
+                case ND_CAST:
+                        if (node->left->node_type != ND_NUM)
+                                return;
+                        l = node->left->val;
+                        break;
+                case ND_ADD:
+                case ND_SUB:
+                case ND_MUL:
+                case ND_DIV:
+                case ND_MOD:
+                case ND_BITAND:
+                case ND_BITOR:
+                case ND_BITXOR:
+                case ND_EQ:
+                case ND_NE:
+                case ND_LT:
+                case ND_LE:
+                case ND_LOGAND:
+                case ND_LOGOR:
+                        if (node->left->node_type != ND_NUM || node->right->node_type != ND_NUM)
+                                return;
+                        l = node->left->val;
+                        r = node->right->val;
+                        break;
+                default:
+                        return;
+        }
+
+        if (!eval_op(node->node_type, l, r, &val))
+                return;
+        node->node_type = ND_NUM;
+        node->val = wrap_to_type(node->type, val);
+}
+
 void add_type(Node *node) {
         if (!node || node->type)
                 return;
+        set_type(node);
+        fold_constant(node);
+}
+
+static void set_type(Node *node) {
+        // Visit only the children this kind of node has
+        switch (node->node_type) {
+                case ND_NUM:
+                case ND_VAR:
+                case ND_NULL_STATEMENT:
+                        break;
+                case ND_IF:
+                        add_type(node->cond);
+                        add_type(node->then);
+                        add_type(node->els);
+                        break;
+                case ND_FOR:
+                        add_type(node->init);
+                        add_type(node->cond);
+                        add_type(node->inc);
+                        add_type(node->then);
+                        break;
+                case ND_BLOCK:
+                case ND_STATEMENT_EXPRESSION:
+                        for (Node *n = node->body; n; n = n->next)
+                                add_type(n);
+                        break;
+                case ND_FUNCALL:
+                        for (Node *n = node->args; n; n = n->next)
+                                add_type(n);
+                        break;
+                case ND_MEMBER:
+                        add_type(node->left);
+                        break;
+                default:
+                        add_type(node->left);
+                        add_type(node->right);
+                        break;
+        }
 
-        add_type(node->left);
-        add_type(node->right);
-        add_type(node->cond);
-        add_type(node->then);
-        add_type(node->els);
-        add_type(node->init);
-        add_type(node->inc);
-
-        for (Node *n = node->body; n; n = n->next)
-                add_type(n);
-        for (Node *n = node->args; n; n = n->next)
-                add_type(n);
         switch (node->node_type) {
                 case ND_NUM:
                         node->type = (node->val == (int)node->val) ? ty_int : ty_long;
@@ -174,3 +370,14 @@ void add_type(Node *node) {
                         return;
         }
 }
+
+void print_type_stats(FILE *out) {
+        fprintf(out, "%-8s %12d types      %12zu bytes table\n", "typetab",
+                        derived_count, sizeof(Type *) * derived_capacity);
+}
+
+// Forgets every derived type. The types themselves go away with type_arena.
+void reset_types(void) {
+        derived_types = NULL;
+        derived_capacity = derived_count = 0;
+}